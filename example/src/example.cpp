@@ -1,6 +1,6 @@
 #include "sformat.h"
 
-#define print(...) fputs(sformat(__VA_ARGS__), stdout)
+#define print(...) sformat_buffered_print(__VA_ARGS__)
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -116,6 +116,20 @@ int main()
     FS("🌵中𓁃א are four utf-8 characters", Max(3)), "\n",
     FS("🌵中𓁃א are four utf-8 characters", Max(2)), "\n");
 
+  print("or aligned by terminal columns: '", FS("日本語", Min(8), Columns), "' '", FS("abc", Min(8), Columns), "' '", FS("🌵中𓁃א", Max(5), Columns), "'\n");
+  print("and without cutting grapheme clusters apart: '", FS("🇩🇪🇫🇷🇮🇹!", Max(6)), "' '", FS("🇩🇪🇫🇷🇮🇹!", Max(6), Graphemes), "'\n");
+
+  const std::string name = "sformat";
+  print("string: '", name, "' view: '", FS(std::string_view(name).substr(0, 3), Min(5), Right), "'\n");
+  print(FL("label", Min(8), Right), ": ", FL("🌵 cactus", Max(6)), FL("\n"));
+  print(L"wide ", u"utf-16 ", U"utf-32 ", FS(U"🌵中𓁃א", Min(6), Right), "\n");
+
+  print("escaped: {\"text\": \"", FS("say \"hi\"\n", EscapeJson), "\"} ", FS("tab\t\x1b[0m", EscapeControl), "\n");
+
+  print("validated: '", FS("bad \xFF utf-8 \xE2\x82", Validate, Min(16)), "'\n");
+
+  print("case converted: ", FS("Größe", Upper), " ", FS("ΑΒΓ Привет", Lower), "\n");
+
   print(FS("left", Left, Min(8)), " aligned: '", FI(Left, Min(10))(12345), "'\n");
   print(FS("right", Right, Min(8)), " aligned: '", FI(Right, Min(10))(12345), "'\n");
   print(FS("center", Center, Min(8)), " aligned: '", FI(Center, Min(10))(12345), "'\n");
@@ -128,13 +142,33 @@ int main()
   print("some fractional digits (rounded): ", FD(Frac(3))(1.98765), " / ", FD(Frac(3))(0.999), "\n");
   print("all fractional digits: ", FD(AllFrac)(1.98765), " / ", FD(AllFrac)(0.999), "\n");
 
+  print("fixed point: ", FI(Scale(8), Frac(2), Group)(123456789012), " / ", FI(Scale(8), Frac(8))(-150000000), "\n");
+
   print("exponential fp notation: ", FD(Exp)(1.98765), " / ", FD(Exp, AllFrac)(4.72135e9), "\n");
+  print("shortest notation: ", FD(Shortest)(123456.789), " / ", FD(Shortest)(1e6), " / ", FD(Shortest)(0.1 + 0.2), "\n");
+  print("engineering notation: ", FD(Eng)(0.00012345), " / ", FD(Eng, Frac(2))(-25.5e6), "\n");
+  print("SI prefixes: ", FD(SI)(0.00012345), " / ", FD(SI, Frac(2))(-25.5e6), "\n");
+  print("hex fp notation: ", FD(HexFloat)(0.1), " / ", FD(HexFloat, x)(-2.5), "\n");
 
   print("Spaces: '", FI(Min(10))(1234), "'\n");
   print("Zeroes: '", FI(Min(10), Fill0)(1234), "'\n");
   print("Grouped: '", FI(Min(10), Fill0, Group)(1234), "'\n");
 
+  const sformatView view = sformat_view("formatted with known length: ", 42, "\n");
+  sformat_flush();
+  sformat_write(1, view);
+
+  std::string appended = "appended:";
+
+  for (int i = 0; i < 3; i++)
+    sformat_append(appended, " ", i);
+
+  print(appended, "\n");
+
   print("Custom Types: ", vec2t<float>(0.1f, -0.5f), " or ", vec3t<double>(1.4, -2.5, 0.), ".\n");
 
+  // `print` only buffers its output, which would otherwise be written once the next message doesn't fit, the next `print` after `bufferedPrintMaxAgeMs` or when the thread exits.
+  sformat_flush();
+
   return 0;
 }
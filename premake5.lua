@@ -1,3 +1,8 @@
+newoption {
+  trigger = "compact-float-cache",
+  description = "Use dragonbox' compact (~0.6 KiB) instead of the full (~10 KiB) power of ten cache for double formatting"
+}
+
 solution "sformat"
   
   editorintegration "On"
@@ -6,3 +11,4 @@ solution "sformat"
 
   dofile "project.lua"
   dofile "example/project.lua"
+  dofile "test/project.lua"
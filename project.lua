@@ -22,6 +22,10 @@ project(ProjectName)
   filter { }
   
   defines { "_CRT_SECURE_NO_WARNINGS", "SSE2" }
+
+  filter { "options:compact-float-cache" }
+    defines { "SFORMAT_DRAGONBOX_COMPACT_CACHE" }
+  filter { }
   
   objdir "intermediate/obj"
 
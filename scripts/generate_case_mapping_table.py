@@ -0,0 +1,36 @@
+# Generates the case mapping tables for Latin, Greek & Cyrillic used by sformat.cpp (`_sformat_UpperCaseOffsets` & `_sformat_LowerCaseOffsets`).
+# Usage: python3 scripts/generate_case_mapping_table.py > table.txt, then replace the corresponding section in sformat.cpp.
+
+import sys
+import unicodedata
+
+FIRST = 0x80 # ASCII is converted in code.
+LIMIT = 0x530 # Latin-1 Supplement, Latin Extended-A & B, IPA Extensions, Greek & Coptic, Cyrillic & Cyrillic Supplement.
+
+def offset(codepoint, convert):
+  mapped = convert(chr(codepoint))
+
+  # Mappings to multiple code points (like 'ß' -> 'SS') would change the number of code points and mappings to code points that take up more bytes as UTF-8 (like 'ɐ' -> 'Ɐ') could overflow the output, so both are left unchanged.
+  if len(mapped) != 1 or len(mapped.encode('utf-8')) > len(chr(codepoint).encode('utf-8')):
+    return 0
+
+  return ord(mapped) - codepoint
+
+def write_table(out, name, convert):
+  offsets = [offset(cp, convert) for cp in range(FIRST, LIMIT)]
+
+  assert all(-0x8000 <= x < 0x8000 for x in offsets)
+
+  out.write('static const int16_t %s[0x%X - 0x%X] =\n{\n' % (name, LIMIT, FIRST))
+
+  for i in range(0, len(offsets), 16):
+    out.write('  ' + ', '.join('%d' % x for x in offsets[i:i + 16]) + ',\n')
+
+  out.write('};\n')
+
+out = sys.stdout
+out.write('// Generated by `scripts/generate_case_mapping_table.py` from Unicode %s.\n' % unicodedata.unidata_version)
+out.write('// Offsets from the code points U+%04X to U+%04X to their upper / lower case mapping (if it\'s a single code point that doesn\'t take up more bytes as UTF-8).\n' % (FIRST, LIMIT - 1))
+write_table(out, '_sformat_UpperCaseOffsets', str.upper)
+out.write('\n')
+write_table(out, '_sformat_LowerCaseOffsets', str.lower)
@@ -0,0 +1,55 @@
+# Generates the two-stage terminal display width table used by sformat.cpp (`_sformat_DisplayWidthBlockIndex` & `_sformat_DisplayWidthBlocks`).
+# Usage: python3 scripts/generate_display_width_table.py > table.txt, then replace the corresponding section in sformat.cpp.
+
+import sys
+import unicodedata
+
+LIMIT = 0x20000 # code points from U+20000 to U+3FFFD are all wide, everything above is narrow (except for tags & variation selectors), which is handled in code.
+BLOCK_SIZE = 128
+
+def display_width(codepoint):
+  if codepoint < 0x80: # ASCII is always handled as a width of 1.
+    return 1
+
+  char = chr(codepoint)
+  category = unicodedata.category(char)
+
+  if codepoint == 0xAD: # soft hyphen is usually displayed.
+    return 1
+
+  if category in ('Mn', 'Me', 'Cf', 'Cc') or 0x1160 <= codepoint <= 0x11FF or codepoint == 0x200B: # combining marks, format & control characters, hangul medial vowels & final consonants.
+    return 0
+
+  if unicodedata.east_asian_width(char) in ('W', 'F'): # includes emoji presentation code points since Unicode 9.
+    return 2
+
+  return 1
+
+widths = [display_width(cp) for cp in range(LIMIT)]
+blocks = {}
+block_index = []
+
+for block_start in range(0, LIMIT, BLOCK_SIZE):
+  block = tuple(widths[block_start:block_start + BLOCK_SIZE])
+  block_index.append(blocks.setdefault(block, len(blocks)))
+
+assert len(blocks) <= 256
+
+def pack(block):
+  return [block[i] | (block[i + 1] << 2) | (block[i + 2] << 4) | (block[i + 3] << 6) for i in range(0, BLOCK_SIZE, 4)]
+
+out = sys.stdout
+out.write('// Generated by `scripts/generate_display_width_table.py` from Unicode %s.\n' % unicodedata.unidata_version)
+out.write('// Terminal columns of all code points below U+%X in blocks of %d code points with 2 bits per code point.\n' % (LIMIT, BLOCK_SIZE))
+out.write('static const uint8_t _sformat_DisplayWidthBlockIndex[0x%X / %d] =\n{\n' % (LIMIT, BLOCK_SIZE))
+
+for i in range(0, len(block_index), 32):
+  out.write('  ' + ', '.join('%d' % x for x in block_index[i:i + 32]) + ',\n')
+
+out.write('};\n\n')
+out.write('static const uint8_t _sformat_DisplayWidthBlocks[%d][%d / 4] =\n{\n' % (len(blocks), BLOCK_SIZE))
+
+for block in sorted(blocks, key=lambda b: blocks[b]):
+  out.write('  { ' + ', '.join('0x%02X' % x for x in pack(block)) + ' },\n')
+
+out.write('};\n')
@@ -0,0 +1,79 @@
+# Generates the two-stage grapheme cluster break property table used by sformat.cpp (`_sformat_GraphemeBreakBlockIndex` & `_sformat_GraphemeBreakBlocks`).
+# Usage: python3 scripts/generate_grapheme_break_table.py GraphemeBreakProperty.txt emoji-data.txt > table.txt, then replace the corresponding section in sformat.cpp.
+# Both files are part of the Unicode Character Database (https://www.unicode.org/Public/UCD/latest/ucd/).
+
+import re
+import sys
+
+LIMIT = 0x20000 # everything above is handled in code (see `_sformat_GetGraphemeBreakProperty`).
+BLOCK_SIZE = 128
+
+# Has to match `_sformat_GraphemeBreakProperty` in sformat.cpp.
+PROPERTIES = ['Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator', 'Prepend', 'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT', 'Extended_Pictographic']
+
+def parse(path, properties):
+  version = None
+
+  with open(path, encoding='utf-8') as file:
+    for line in file:
+      if version is None:
+        match = re.search(r'-(\d+\.\d+\.\d+)\.txt', line)
+
+        if match:
+          version = match.group(1)
+
+      line = line.split('#', 1)[0].strip()
+
+      if not line:
+        continue
+
+      codepoints, name = [x.strip() for x in line.split(';')[:2]]
+
+      if name not in PROPERTIES:
+        continue
+
+      first, _, last = codepoints.partition('..')
+      yield version, int(first, 16), int(last or first, 16), PROPERTIES.index(name)
+
+properties = [0] * LIMIT
+version = None
+
+for version, first, last, value in parse(sys.argv[1], PROPERTIES):
+  for cp in range(first, min(last + 1, LIMIT)):
+    properties[cp] = value
+
+for _, first, last, value in parse(sys.argv[2], PROPERTIES):
+  if value != PROPERTIES.index('Extended_Pictographic'):
+    continue
+
+  for cp in range(first, min(last + 1, LIMIT)):
+    assert properties[cp] == 0
+    properties[cp] = value
+
+blocks = {}
+block_index = []
+
+for block_start in range(0, LIMIT, BLOCK_SIZE):
+  block = tuple(properties[block_start:block_start + BLOCK_SIZE])
+  block_index.append(blocks.setdefault(block, len(blocks)))
+
+assert len(blocks) <= 256
+
+def pack(block):
+  return [block[i] | (block[i + 1] << 4) for i in range(0, BLOCK_SIZE, 2)]
+
+out = sys.stdout
+out.write('// Generated by `scripts/generate_grapheme_break_table.py` from Unicode %s.\n' % version)
+out.write('// Grapheme cluster break properties of all code points below U+%X in blocks of %d code points with 4 bits per code point.\n' % (LIMIT, BLOCK_SIZE))
+out.write('static const uint8_t _sformat_GraphemeBreakBlockIndex[0x%X / %d] =\n{\n' % (LIMIT, BLOCK_SIZE))
+
+for i in range(0, len(block_index), 32):
+  out.write('  ' + ', '.join('%d' % x for x in block_index[i:i + 32]) + ',\n')
+
+out.write('};\n\n')
+out.write('static const uint8_t _sformat_GraphemeBreakBlocks[%d][%d / 2] =\n{\n' % (len(blocks), BLOCK_SIZE))
+
+for block in sorted(blocks, key=lambda b: blocks[b]):
+  out.write('  { ' + ', '.join('0x%02X' % x for x in pack(block)) + ' },\n')
+
+out.write('};\n')
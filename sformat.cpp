@@ -3655,6 +3655,28 @@ const char *unicode_converter(uint32_t codepoint, uint8_t size) {
 
 #ifdef _WIN32
 #include <Windows.h>
+#include <io.h>
+#include <limits.h>
+#else
+#include <unistd.h>
+#include <errno.h>
+#include <limits.h>
+#include <sys/mman.h>
+#include <time.h>
+#endif
+
+#ifndef IOV_MAX
+#define IOV_MAX 1024
+#endif
+
+#if defined(SSE2) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _SFORMAT_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define _SFORMAT_AVX2
+#include <immintrin.h>
 #endif
 
 //////////////////////////////////////////////////////////////////////////
@@ -3670,9 +3692,14 @@ bool _sformat_default_alloc(void **ppData, const size_t bytes)
 bool _sformat_default_realloc(void **ppData, const size_t bytes)
 {
   void *pRes = realloc(*ppData, bytes);
+
+  // The original allocation is still valid if `realloc` failed.
+  if (pRes == nullptr)
+    return false;
+
   *ppData = pRes;
 
-  return pRes != nullptr;
+  return true;
 }
 
 void _sformat_default_free(void *pData)
@@ -3689,8 +3716,642 @@ sformat_allocator _default_sformat_allocator =
 
 //////////////////////////////////////////////////////////////////////////
 
+// `full` uses a ~10 KiB table of powers of ten for `double`, `compact` recovers most of them from a ~0.6 KiB table at the cost of a few multiplications per conversion.
+#ifdef SFORMAT_DRAGONBOX_COMPACT_CACHE
+static constexpr auto _sformat_DragonboxCachePolicy = jkj::dragonbox::policy::cache::compact;
+#else
+static constexpr auto _sformat_DragonboxCachePolicy = jkj::dragonbox::policy::cache::full;
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+
+// Generated by `scripts/generate_display_width_table.py` from Unicode 14.0.0.
+// Terminal columns of all code points below U+20000 in blocks of 128 code points with 2 bits per code point.
+static const uint8_t _sformat_DisplayWidthBlockIndex[0x20000 / 128] =
+{
+  0, 1, 0, 0, 0, 0, 2, 3, 0, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26,
+  27, 28, 29, 30, 31, 32, 33, 34, 0, 0, 0, 0, 0, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 0, 48, 0, 0, 49, 50,
+  51, 52, 0, 53, 0, 0, 54, 55, 56, 0, 0, 57, 58, 59, 60, 61, 0, 0, 0, 0, 0, 0, 62, 63, 0, 64, 65, 66, 67, 68, 68, 68,
+  69, 70, 68, 68, 71, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 72, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 73, 0, 0, 74, 75, 0, 76, 77, 78, 79, 80, 81, 82, 83, 84, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 85, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 68, 68, 68, 68, 86, 87, 0, 0, 0, 88, 89, 90, 91, 92,
+  93, 94, 95, 96, 68, 97, 98, 99, 0, 100, 101, 102, 0, 0, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 68, 116, 117, 118, 119,
+  120, 121, 122, 123, 124, 125, 126, 68, 127, 128, 68, 129, 130, 131, 132, 68, 133, 134, 135, 136, 137, 138, 68, 68, 139, 140, 141, 142, 68, 143, 68, 144,
+  0, 0, 0, 0, 0, 0, 0, 145, 146, 0, 147, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 148,
+  0, 0, 0, 0, 0, 0, 0, 0, 149, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 150, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 0, 0, 0, 0, 151, 152, 153, 154, 68, 68, 68, 68, 72, 155, 156, 157,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 158, 159, 68, 68, 68, 68, 68, 68,
+  68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 68, 160, 147,
+  0, 161, 162, 163, 164, 165, 166, 68, 167, 168, 169, 0, 0, 170, 0, 171, 0, 0, 0, 0, 172, 173, 68, 68, 68, 68, 68, 68, 68, 68, 174, 68,
+  175, 68, 176, 68, 68, 177, 68, 68, 68, 68, 68, 68, 68, 68, 68, 178, 0, 179, 180, 68, 68, 68, 68, 68, 181, 182, 183, 68, 184, 185, 68, 68,
+  186, 187, 0, 188, 68, 68, 189, 190, 191, 192, 193, 194, 73, 195, 196, 197, 198, 199, 200, 68, 201, 68, 0, 202, 68, 68, 68, 68, 68, 68, 68, 68,
+};
+
+static const uint8_t _sformat_DisplayWidthBlocks[203][128 / 4] =
+{
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x5A, 0x55 },
+  { 0xAA, 0x55, 0x95, 0x59, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x95, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x41, 0x10, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x6A, 0x55, 0xA9, 0xAA, 0xAA },
+  { 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x10, 0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x25, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0xA4, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x95, 0x52 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00, 0x00, 0x01, 0x01, 0xA0, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x9A, 0x55, 0x55, 0x95, 0xAA, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x95, 0xA0, 0xAA, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54, 0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x51, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x99, 0x5A, 0xA5, 0x54, 0x01, 0x68, 0x69, 0x91, 0xAA, 0x6A, 0xAA, 0x65, 0x05, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x85 },
+  { 0x42, 0x56, 0x95, 0x6A, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x96, 0xA5, 0x58, 0x81, 0x2A, 0x28, 0xA0, 0xA2, 0xAA, 0x56, 0x99, 0xAA, 0x5A, 0x55, 0x55, 0x50, 0x91, 0xAA, 0xAA },
+  { 0x42, 0x56, 0x55, 0x65, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x56, 0xA5, 0x54, 0x01, 0x20, 0x64, 0xA1, 0xA9, 0xAA, 0xAA, 0xAA, 0x05, 0x5A, 0x55, 0x55, 0xA5, 0xAA, 0x06, 0x00 },
+  { 0x52, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x56, 0xA5, 0x14, 0x01, 0x68, 0x69, 0xA1, 0xAA, 0x42, 0xAA, 0x65, 0x05, 0x5A, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA },
+  { 0x4A, 0x56, 0x95, 0x5A, 0x59, 0xA5, 0x96, 0x59, 0x6A, 0xA9, 0x95, 0x5A, 0x55, 0x55, 0xA5, 0x5A, 0x94, 0x5A, 0x59, 0xA1, 0xA9, 0x6A, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA },
+  { 0x54, 0x54, 0x55, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0xA5, 0x04, 0x54, 0x09, 0x08, 0xA0, 0xAA, 0x82, 0x95, 0xA6, 0x05, 0x5A, 0x55, 0x55, 0xAA, 0x6A, 0x55, 0x55 },
+  { 0x51, 0x55, 0x55, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x56, 0xA5, 0x14, 0x55, 0x49, 0x59, 0xA0, 0xAA, 0x96, 0xAA, 0x96, 0x05, 0x5A, 0x55, 0x55, 0x96, 0xAA, 0xAA, 0xAA },
+  { 0x50, 0x55, 0x55, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0x01, 0x58, 0x59, 0x51, 0xAA, 0x55, 0x55, 0x55, 0x05, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x52, 0x56, 0x55, 0x55, 0x55, 0x95, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xA6, 0x55, 0x95, 0x8A, 0x6A, 0x05, 0x88, 0x55, 0x55, 0xAA, 0x5A, 0x55, 0x55, 0x5A, 0xA9, 0xAA, 0xAA },
+  { 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x80, 0x6A, 0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x96, 0x59, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x55, 0x51, 0x00, 0x00, 0xA4, 0x55, 0x99, 0x00, 0xA0, 0x55, 0x55, 0xA5, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x02, 0x00, 0x00, 0x40 },
+  { 0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x55, 0x45, 0x55, 0x59, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55 },
+  { 0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0xAA, 0xA6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0xA5, 0x55, 0x95, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0xA5, 0x55, 0x95, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0xA5 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x05, 0xA4, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x05, 0x95, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x05, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x59, 0x09, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50, 0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0xA1, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0xA5, 0xAA },
+  { 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA },
+  { 0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x40, 0x15, 0x54, 0xAA, 0x45, 0x55, 0x01, 0xAA, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0xA9, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x95, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x80, 0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x28 },
+  { 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54, 0x45, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x95 },
+  { 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x50, 0x11, 0x50, 0xAA, 0xAA, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x6A, 0x55, 0x55, 0x55, 0xA5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0x90, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0x55, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x59, 0x55, 0x95 },
+  { 0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x08, 0x00, 0x00, 0xA5, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x56, 0x96, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95 },
+  { 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x59, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x5A, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0xA5, 0x59, 0x65, 0x59 },
+  { 0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x95, 0x9A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0xAA, 0x56, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0xAA, 0xA6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x6A, 0xA9, 0xAA, 0xAA, 0x2A },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xA0, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x82, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x65, 0x56, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55 },
+  { 0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0xA8, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA0, 0xAA, 0x5A, 0x55, 0x55, 0xA5, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x50, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xA5, 0x5A, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x41, 0x81, 0xAA, 0xAA, 0x15, 0x55, 0x55, 0xA4, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05, 0x91, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x85, 0xAA, 0xAA },
+  { 0x56, 0x95, 0x56, 0x95, 0x56, 0x95, 0xAA, 0xAA, 0x55, 0x95, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x54, 0xA1, 0x55, 0x55, 0xA5, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA },
+  { 0x55, 0x95, 0xAA, 0xAA, 0x6A, 0x55, 0xAA, 0x46, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x99, 0x65, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55 },
+  { 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x59, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x29 },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x5A, 0x55, 0x5A, 0x55, 0x5A, 0x55, 0x5A, 0xA9, 0xAA, 0xAA, 0x55, 0x95, 0xAA, 0xAA, 0x02, 0xA5 },
+  { 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x95, 0x65, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA },
+  { 0x95, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA1 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x80, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x95, 0x55 },
+  { 0x55, 0x55, 0x95, 0x55, 0x95, 0x65, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x65, 0x55, 0x65, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0xA5, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0xA9, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x6A, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x95, 0xA5, 0x6A, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x01, 0x82, 0xAA, 0x00, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x80, 0x2A, 0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x81, 0x6A, 0x55, 0x55, 0x95, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0x56, 0xA9, 0xAA, 0xAA, 0x56, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x5A, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x25, 0xA4, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55 },
+  { 0x05, 0x50, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA },
+  { 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x40, 0x55, 0xA5, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14, 0xA4, 0xAA, 0x2A },
+  { 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x51, 0x85, 0xAA, 0xAA, 0xA2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0xA5, 0xAA },
+  { 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x58, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x95, 0xAA, 0xAA },
+  { 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40, 0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0x85, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x95, 0x59, 0x65, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x15, 0x00, 0x80, 0xAA, 0x55, 0x55, 0xA5, 0xAA },
+  { 0x50, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x56, 0x25, 0x54, 0x54, 0x69, 0x69, 0xA5, 0xA9, 0x6A, 0xAA, 0x56, 0x55, 0x0A, 0x00, 0xA8, 0x00, 0xA8, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x46, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15, 0x04, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0xA0, 0x55, 0x10, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11, 0x54, 0xA9, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0xA5, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02, 0x05, 0x10, 0x00, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0x6A },
+  { 0x55, 0x95, 0xA6, 0x55, 0x55, 0x96, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x29, 0x44, 0x15, 0x95, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x0A, 0x55, 0x54, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40, 0x55, 0x15, 0xAA, 0xAA, 0x01, 0x40, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA },
+  { 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x80, 0x00, 0x10, 0x55, 0xA5, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x81, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x95, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x80, 0x8A, 0x20, 0x00, 0x10, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x65, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x95, 0x60, 0x11, 0xA9, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0xA9, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0x6A },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0xA9, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0xA5, 0x5A, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x00, 0xA4, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0x55, 0x55, 0x65, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x56 },
+  { 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x2A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0xAA, 0x2A, 0x40, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x55, 0x55, 0x55, 0xA9 },
+  { 0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0xA5, 0x41, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00 },
+  { 0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0xA4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x9A, 0x96, 0x56, 0x59, 0x55, 0x55, 0x65, 0x56, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x65, 0x95, 0x56, 0x55, 0x59, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x95, 0x55, 0x99, 0x5A, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55 },
+  { 0x55, 0x54, 0x55, 0xAA, 0xAA, 0xAA, 0x2A, 0x00, 0x02, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x20, 0x08, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x00, 0x40, 0x55, 0xA5, 0x55, 0x55, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x85, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0xA5, 0x6A },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x95, 0x55, 0x96, 0x55, 0x55, 0x55, 0x95 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0xAA, 0x55, 0x55, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x96, 0x69, 0x56, 0x55, 0x95, 0x55, 0x66, 0xAA, 0x9A, 0x6A, 0x66, 0x56, 0x96, 0x69, 0x66, 0x66, 0x96, 0x69, 0x95, 0x55, 0x95, 0x55, 0x56, 0x99 },
+  { 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x56, 0x56, 0x65, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x65, 0xA9, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0xA9, 0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6 },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x95, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x56, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x96 },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x95, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55 },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x56, 0x6A, 0xA9, 0xAA, 0xAA, 0x55, 0x55, 0x95, 0xAA, 0x55, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55 },
+  { 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA },
+};
+
+// Generated by `scripts/generate_grapheme_break_table.py` from Unicode 15.0.0.
+// Grapheme cluster break properties of all code points below U+20000 in blocks of 128 code points with 4 bits per code point.
+static const uint8_t _sformat_GraphemeBreakBlockIndex[0x20000 / 128] =
+{
+  0, 1, 2, 2, 2, 2, 3, 2, 2, 4, 2, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+  26, 27, 28, 29, 2, 2, 30, 2, 2, 2, 2, 2, 2, 2, 31, 32, 33, 34, 35, 2, 36, 37, 38, 39, 40, 41, 2, 42, 2, 2, 2, 2,
+  43, 44, 45, 46, 2, 2, 47, 48, 2, 49, 2, 50, 51, 52, 53, 54, 2, 2, 55, 2, 2, 2, 56, 2, 2, 57, 58, 59, 2, 2, 2, 2,
+  60, 61, 2, 2, 2, 62, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 63, 64, 2, 2, 65, 66, 67, 68, 69, 70, 2, 71, 72, 73, 74, 75, 76, 77, 78, 72,
+  73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76,
+  77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73,
+  74, 75, 76, 77, 78, 72, 73, 74, 75, 76, 77, 78, 72, 73, 74, 79, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 80, 2, 2, 2, 2, 2, 81, 82, 2, 83,
+  2, 2, 2, 84, 2, 85, 86, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 87, 88, 2, 2, 2, 2, 89, 2, 2, 90, 91, 92,
+  93, 94, 95, 96, 97, 98, 99, 2, 100, 101, 2, 102, 103, 104, 105, 2, 106, 2, 107, 108, 109, 110, 2, 2, 111, 112, 113, 114, 2, 115, 116, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 117, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 118, 119, 2, 2, 2, 2, 2, 2, 2, 120, 121,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 122, 2, 2, 2, 2, 2, 2,
+  2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 123, 2,
+  2, 2, 124, 125, 126, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 127, 128, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  129, 130, 119, 2, 2, 131, 2, 2, 2, 132, 2, 2, 2, 2, 2, 2, 2, 133, 134, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+  135, 135, 136, 137, 138, 135, 135, 139, 135, 135, 140, 135, 141, 135, 142, 143, 144, 145, 146, 135, 135, 135, 2, 2, 135, 135, 135, 135, 135, 135, 135, 147,
+};
+
+static const uint8_t _sformat_GraphemeBreakBlocks[148][128 / 2] =
+{
+  { 0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30 },
+  { 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x30, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x40, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x77, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x74, 0x40, 0x44, 0x44, 0x04, 0x40, 0x04, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x40, 0x44, 0x44, 0x44, 0x44, 0x40, 0x44, 0x40, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44 },
+  { 0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x04, 0x88, 0x48, 0x44, 0x44, 0x44, 0x84, 0x88, 0x48, 0x88, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84, 0x48, 0x44, 0x04, 0x80, 0x08, 0x80, 0x48, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 },
+  { 0x40, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x48, 0x04, 0x00, 0x40, 0x04, 0x40, 0x44, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x40, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x48, 0x44, 0x44, 0x40, 0x84, 0x80, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44 },
+  { 0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x48, 0x44, 0x04, 0x80, 0x08, 0x80, 0x48, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x84, 0x08, 0x00, 0x88, 0x08, 0x88, 0x48, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x84, 0x88, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x84, 0x88, 0x08, 0x44, 0x04, 0x44, 0x44, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x48, 0x88, 0x84, 0x08, 0x84, 0x08, 0x88, 0x44, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x84, 0x48, 0x44, 0x04, 0x88, 0x08, 0x88, 0x48, 0x07, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x88, 0x44, 0x04, 0x04, 0x88, 0x88, 0x88, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x84 },
+  { 0x44, 0x44, 0x04, 0x44, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x84, 0x44, 0x44, 0x44, 0x40, 0x84, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x44, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x04, 0x48, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA },
+  { 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x44, 0x44, 0x44, 0x88, 0x88, 0x88, 0x88, 0x84, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x84, 0x88, 0x48, 0x84, 0x88, 0x00, 0x00, 0x88, 0x84, 0x88, 0x88, 0x48, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x84, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x84, 0x44, 0x44, 0x44, 0x04, 0x04, 0x04, 0x40, 0x44, 0x44, 0x44, 0x84, 0x88, 0x88, 0x48, 0x44, 0x44, 0x44, 0x44, 0x04, 0x40 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x84, 0x84, 0x88, 0x88, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0x44, 0x88, 0x44, 0x48, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x44, 0x88, 0x48, 0x48, 0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x44, 0x44, 0x44, 0x44, 0x88, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x84, 0x44, 0x44, 0x44, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x80, 0x44, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x54, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0xEE, 0x0E, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0x0E },
+  { 0xEE, 0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0xEE, 0xEE, 0xEE, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0xE0, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0xE0, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x04, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x48, 0x84, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0x00 },
+  { 0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x44, 0x44, 0x88, 0x44, 0x88, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x48, 0x84, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x04, 0x40, 0x04, 0x00, 0x00, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0x88, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x48, 0x88, 0x84, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD },
+  { 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD },
+  { 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD },
+  { 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD },
+  { 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD },
+  { 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD },
+  { 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD },
+  { 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0xB0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00 },
+  { 0x40, 0x44, 0x40, 0x04, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40 },
+  { 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x84, 0x48, 0x04, 0x70, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x48, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x44, 0x44, 0x84, 0x08, 0x77, 0x00, 0x00, 0x40, 0x44, 0x04, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x88, 0x84, 0x44, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x48, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x84, 0x84, 0x88, 0x08, 0x80, 0x08, 0x80, 0x88, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x44, 0x44, 0x88, 0x44, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x48, 0x44, 0x44, 0x84, 0x84, 0x48, 0x48, 0x84, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x44, 0x44, 0x00, 0x88, 0x88, 0x44, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x44, 0x44, 0x84, 0x48, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x88, 0x44, 0x44, 0x44, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x44, 0x44, 0x48, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x44, 0x44, 0x44, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x88, 0x88, 0x80, 0x08, 0x40, 0x84, 0x74, 0x78, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x00, 0x44, 0x88, 0x88, 0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x40, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x47, 0x44, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x48, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x77, 0x77, 0x77, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x84, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0x44, 0x44, 0x04, 0x44, 0x44, 0x44, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x80, 0x44, 0x44, 0x44, 0x84, 0x44, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x04, 0x00, 0x04, 0x44, 0x40, 0x44, 0x44, 0x44, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x08, 0x44, 0x80, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x44, 0x44, 0x04, 0x00, 0x88, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x04, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88 },
+  { 0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x44, 0x00, 0x80, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x43, 0x44, 0x44 },
+  { 0x44, 0x04, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x44, 0x44, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x40, 0x44, 0x44, 0x44, 0x40, 0x04, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66 },
+  { 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x4E, 0x44, 0x44 },
+  { 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+  { 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE },
+  { 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00 },
+};
+
+//////////////////////////////////////////////////////////////////////////
+
+// Generated by `scripts/generate_case_mapping_table.py` from Unicode 14.0.0.
+// Offsets from the code points U+0080 to U+052F to their upper / lower case mapping (if it's a single code point that doesn't take up more bytes as UTF-8).
+static const int16_t _sformat_UpperCaseOffsets[0x530 - 0x80] =
+{
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 743, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32,
+  -32, -32, -32, -32, -32, -32, -32, 0, -32, -32, -32, -32, -32, -32, -32, 121,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -232, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, 0,
+  -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, 0, -1, 0, -1, 0, -1, -300,
+  195, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0,
+  0, 0, -1, 0, 0, 97, 0, 0, 0, -1, 163, 0, 0, 0, 130, 0,
+  0, -1, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0,
+  -1, 0, 0, 0, -1, 0, -1, 0, 0, -1, 0, 0, 0, -1, 0, 56,
+  0, 0, 0, 0, 0, -1, -2, 0, -1, -2, 0, -1, -2, 0, -1, 0,
+  -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -79, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, 0, -1, -2, 0, -1, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0,
+  0, 0, -1, 0, 0, 0, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, 0, 0, -210, -206, 0, -205, -205, 0, -202, 0, -203, 0, 0, 0, 0,
+  -205, 0, 0, -207, 0, 0, 0, 0, -209, -211, 0, 0, 0, 0, 0, -211,
+  0, 0, -213, 0, 0, -214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -218, 0, 0, -218, 0, 0, 0, 0, -218, -69, -217, -217, -71, 0, 0, 0,
+  0, 0, -219, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, -1, 0, -1, 0, 0, 0, -1, 0, 0, 0, 130, 130, 130, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -38, -37, -37, -37,
+  0, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32,
+  -32, -32, -31, -32, -32, -32, -32, -32, -32, -32, -32, -32, -64, -63, -63, 0,
+  -62, -57, 0, 0, 0, -47, -54, -8, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  -86, -80, 7, -116, 0, -96, 0, 0, -1, 0, 0, -1, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32,
+  -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32, -32,
+  -80, -80, -80, -80, -80, -80, -80, -80, -80, -80, -80, -80, -80, -80, -80, -80,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, -15,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+  0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1,
+};
+
+static const int16_t _sformat_LowerCaseOffsets[0x530 - 0x80] =
+{
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 0, 32, 32, 32, 32, 32, 32, 32, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  0, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0, 1,
+  0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, -121, 1, 0, 1, 0, 1, 0, 0,
+  0, 210, 1, 0, 1, 0, 206, 1, 0, 205, 205, 1, 0, 0, 79, 202,
+  203, 1, 0, 205, 207, 0, 211, 209, 1, 0, 0, 0, 211, 213, 0, 214,
+  1, 0, 1, 0, 1, 0, 218, 1, 0, 218, 0, 0, 1, 0, 218, 1,
+  0, 217, 217, 1, 0, 1, 0, 219, 1, 0, 0, 0, 1, 0, 0, 0,
+  0, 0, 0, 0, 2, 1, 0, 2, 1, 0, 2, 1, 0, 1, 0, 1,
+  0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  0, 2, 1, 0, 1, 0, -97, -56, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  -130, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -163, 0, 0,
+  0, 1, 0, -195, 69, 71, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 116,
+  0, 0, 0, 0, 0, 0, 38, 0, 37, 37, 37, 0, 64, 0, 63, 63,
+  0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 0, 32, 32, 32, 32, 32, 32, 32, 32, 32, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+  0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  0, 0, 0, 0, -60, 0, 0, 1, 0, -7, 1, 0, 0, -130, -130, -130,
+  80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  15, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+  1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0,
+};
+
+//////////////////////////////////////////////////////////////////////////
+
 static sformatState sformat_GlobalState;
-thread_local sformatState sformat_LocalState = sformat_GlobalState;
+
+static bool _sformat_FlushPrintBuffer(sformatState &fs);
+
+// Writes buffered output & frees the thread local buffers when the thread exits.
+struct _sformatThreadLocalState : sformatState
+{
+  _sformatThreadLocalState(const sformatState &copy) : sformatState(copy)
+  {
+    textStart = nullptr;
+    textCapacity = 0;
+    textPosition = 0;
+    inFormatStatement = false;
+  }
+
+  ~_sformatThreadLocalState()
+  {
+    _sformat_FlushPrintBuffer(*this);
+
+    if (textStart != nullptr)
+      pAllocator->free(textStart);
+
+    if (printBufferStart != nullptr)
+      pAllocator->free(printBufferStart);
+  }
+};
+
+thread_local _sformatThreadLocalState sformat_LocalState = sformat_GlobalState;
 
 sformatState &sformat_GetState()
 {
@@ -3702,6 +4363,275 @@ sformatState &sformat_GetGlobalState()
   return sformat_GlobalState;
 }
 
+bool sformat_ReleaseThreadBuffer()
+{
+  sformatState &fs = sformat_LocalState;
+
+  if (fs.inFormatStatement)
+    return false;
+
+  if (fs.textStart != nullptr)
+    fs.pAllocator->free(fs.textStart);
+
+  fs.textStart = nullptr;
+  fs.textCapacity = 0;
+  fs.textPosition = 0;
+  fs.textUnderusedCalls = 0;
+  fs.textUnderusedMaxPosition = 0;
+
+  return true;
+}
+
+// Transparent huge pages on x86_64 & aarch64 (with 4 KiB base pages).
+constexpr size_t _sformat_HugePageSize = 2 * 1024 * 1024;
+
+size_t sformat_GetPageSize()
+{
+#ifdef _WIN32
+  SYSTEM_INFO systemInfo;
+  GetSystemInfo(&systemInfo);
+
+  return (size_t)systemInfo.dwPageSize;
+#else
+  const long pageSize = sysconf(_SC_PAGESIZE);
+
+  return pageSize > 0 ? (size_t)pageSize : 4096;
+#endif
+}
+
+static size_t _sformat_AlignThreadBufferCapacity(const sformatState &fs, const size_t capacity)
+{
+  size_t alignment = _max(fs.textCapacityAlignment, (size_t)1);
+
+  if (fs.textHugePageMinCapacity != 0 && capacity >= fs.textHugePageMinCapacity)
+    alignment = _max(alignment, _sformat_HugePageSize);
+
+  return (capacity + alignment - 1) / alignment * alignment;
+}
+
+size_t _sformat_GetNextThreadBufferCapacity(const sformatState &fs, const size_t capacityRequired)
+{
+  size_t capacity;
+
+  if (fs.textGrowthPercent != 0)
+    capacity = _max(capacityRequired, fs.textCapacity / 100 * fs.textGrowthPercent + fs.textCapacity % 100 * fs.textGrowthPercent / 100);
+  else
+    capacity = capacityRequired + (capacityRequired - fs.textCapacity) * 2;
+
+  return _sformat_AlignThreadBufferCapacity(fs, capacity);
+}
+
+bool _sformat_ReallocThreadBuffer(sformatState &fs, const size_t capacity)
+{
+  if (!fs.pAllocator->realloc(reinterpret_cast<void **>(&fs.textStart), capacity))
+    return false;
+
+  fs.textCapacity = capacity;
+
+#ifdef MADV_HUGEPAGE
+  // The allocation itself usually isn't aligned to huge pages, so only the huge pages it contains completely can be advised.
+  if (fs.textHugePageMinCapacity != 0 && capacity >= fs.textHugePageMinCapacity)
+  {
+    const uintptr_t start = ((uintptr_t)fs.textStart + _sformat_HugePageSize - 1) & ~(uintptr_t)(_sformat_HugePageSize - 1);
+    const uintptr_t end = ((uintptr_t)fs.textStart + capacity) & ~(uintptr_t)(_sformat_HugePageSize - 1);
+
+    if (end > start)
+      madvise(reinterpret_cast<void *>(start), end - start, MADV_HUGEPAGE);
+  }
+#endif
+
+  return true;
+}
+
+bool sformat_Reserve(const size_t capacity)
+{
+  sformatState &fs = sformat_LocalState;
+
+  if (fs.inFormatStatement)
+    return false;
+
+  fs.textShrinkMinCapacity = _max(fs.textShrinkMinCapacity, capacity);
+
+  if (fs.textCapacity >= capacity)
+    return true;
+
+  return _sformat_ReallocThreadBuffer(fs, _sformat_AlignThreadBufferCapacity(fs, capacity));
+}
+
+void _sformat_ShrinkThreadBuffer(sformatState &fs)
+{
+  const size_t capacity = _sformat_AlignThreadBufferCapacity(fs, _max(fs.textShrinkMinCapacity, fs.textUnderusedMaxPosition * 2));
+
+  fs.textUnderusedCalls = 0;
+  fs.textUnderusedMaxPosition = 0;
+
+  // If shrinking fails, we just keep the larger buffer.
+  if (capacity < fs.textCapacity)
+    _sformat_ReallocThreadBuffer(fs, capacity);
+}
+
+bool _sformat_WriteToFileDescriptor(const int fd, const char *text, const size_t length)
+{
+  size_t bytesWritten = 0;
+
+  // `write` may write less than requested (e.g. to pipes or sockets) & `_write` is limited to `INT_MAX` bytes per call.
+  while (bytesWritten < length)
+  {
+#ifdef _WIN32
+    const int result = _write(fd, text + bytesWritten, (unsigned int)_min(length - bytesWritten, (size_t)INT_MAX));
+#else
+    const ssize_t result = write(fd, text + bytesWritten, length - bytesWritten);
+
+    if (result < 0 && errno == EINTR)
+      continue;
+#endif
+
+    if (result <= 0)
+      return false;
+
+    bytesWritten += (size_t)result;
+  }
+
+  return true;
+}
+
+bool _sformat_WriteIOVecsToFileDescriptor(const int fd, const sformatIOVec *pVectors, const size_t count)
+{
+#ifdef _WIN32
+  for (size_t i = 0; i < count; i++)
+    if (!_sformat_WriteToFileDescriptor(fd, reinterpret_cast<const char *>(pVectors[i].iov_base), pVectors[i].iov_len))
+      return false;
+
+  return true;
+#else
+  size_t index = 0;
+
+  while (index < count)
+  {
+    const ssize_t result = writev(fd, pVectors + index, (int)_min(count - index, (size_t)IOV_MAX));
+
+    if (result < 0 && errno == EINTR)
+      continue;
+
+    if (result <= 0)
+      return false;
+
+    size_t bytesWritten = (size_t)result;
+
+    while (index < count && bytesWritten >= pVectors[index].iov_len)
+    {
+      bytesWritten -= pVectors[index].iov_len;
+      index++;
+    }
+
+    // If `writev` stopped in the middle of a vector, write the rest of it on its own.
+    if (bytesWritten != 0)
+    {
+      if (!_sformat_WriteToFileDescriptor(fd, reinterpret_cast<const char *>(pVectors[index].iov_base) + bytesWritten, pVectors[index].iov_len - bytesWritten))
+        return false;
+
+      index++;
+    }
+  }
+
+  return true;
+#endif
+}
+
+static uint64_t _sformat_GetMilliseconds()
+{
+#ifdef _WIN32
+  return GetTickCount64();
+#else
+  struct timespec time;
+
+#ifdef CLOCK_MONOTONIC_COARSE
+  clock_gettime(CLOCK_MONOTONIC_COARSE, &time); // resolution of a few milliseconds, but much cheaper.
+#else
+  clock_gettime(CLOCK_MONOTONIC, &time);
+#endif
+
+  return (uint64_t)time.tv_sec * 1000 + (uint64_t)time.tv_nsec / 1000000;
+#endif
+}
+
+static bool _sformat_FlushPrintBuffer(sformatState &fs)
+{
+  if (fs.printBufferPosition == 0)
+    return true;
+
+  const bool result = _sformat_WriteToFileDescriptor(fs.bufferedPrintFileDescriptor, fs.printBufferStart, fs.printBufferPosition);
+
+  fs.printBufferPosition = 0;
+  fs.printBufferStartTimeMs = 0;
+
+  return result;
+}
+
+bool sformat_flush()
+{
+  return _sformat_FlushPrintBuffer(sformat_LocalState);
+}
+
+bool _sformat_PrepareBufferedPrint(sformatState &fs, const size_t maxBytes, bool &fits)
+{
+  fits = true;
+
+  if (fs.printBufferPosition + maxBytes <= fs.printBufferCapacity)
+    return true;
+
+  if (!_sformat_FlushPrintBuffer(fs))
+    return false;
+
+  if (fs.bufferedPrintFlushBytes == 0)
+  {
+    fits = false;
+    return true;
+  }
+
+  // `bufferedPrintFlushBytes` may have changed since the buffer was allocated.
+  if (fs.printBufferCapacity != fs.bufferedPrintFlushBytes)
+  {
+    if (!fs.pAllocator->realloc(reinterpret_cast<void **>(&fs.printBufferStart), fs.bufferedPrintFlushBytes))
+    {
+      // Without a (new) buffer, the message can still be written on its own.
+      fits = false;
+      return true;
+    }
+
+    fs.printBufferCapacity = fs.bufferedPrintFlushBytes;
+  }
+
+  // Larger messages are streamed through the (now empty) buffer.
+  fits = maxBytes <= fs.printBufferCapacity;
+
+  return true;
+}
+
+bool _sformat_FlushToFileDescriptor(void *pUserData, const char *text, const size_t length)
+{
+  return _sformat_WriteToFileDescriptor(*reinterpret_cast<const int *>(pUserData), text, length);
+}
+
+bool _sformat_FinishBufferedPrint(sformatState &fs)
+{
+  if (fs.bufferedPrintMaxAgeMs == 0)
+    return true;
+
+  const uint64_t now = _sformat_GetMilliseconds();
+
+  if (fs.printBufferStartTimeMs == 0)
+  {
+    fs.printBufferStartTimeMs = _max(now, (uint64_t)1);
+    return true;
+  }
+
+  if (now - fs.printBufferStartTimeMs < fs.bufferedPrintMaxAgeMs)
+    return true;
+
+  return _sformat_FlushPrintBuffer(fs);
+}
+
 void sformatState_ResetCulture()
 {
   sformat_GlobalState.decimalSeparatorLength = sformat_LocalState.decimalSeparatorLength = 1;
@@ -3736,12 +4666,649 @@ void sformatState_ResetCulture()
   sformat_GlobalState.negativeInfinityChars[8] = 'y';
   sformat_GlobalState.negativeInfinityBytes = sformat_GlobalState.negativeInfinityCount = 9;
 
-  sformat_LocalState.SetTo(sformat_GlobalState);
-}
+  sformat_LocalState.SetTo(sformat_GlobalState);
+}
+
+// Returns the number of leading bytes (up to `length`) that are 7-bit ASCII.
+size_t _sformat_GetAsciiPrefixLength(const char *value, const size_t length)
+{
+  size_t i = 0;
+
+#ifdef _SFORMAT_AVX2
+  for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i))
+  {
+    const uint32_t nonAsciiMask = (uint32_t)_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(value + i)));
+
+    if (nonAsciiMask)
+    {
+      unsigned long index;
+#ifdef _MSC_VER
+      _BitScanForward(&index, nonAsciiMask);
+#else
+      index = (unsigned long)__builtin_ctz(nonAsciiMask);
+#endif
+      return i + index;
+    }
+  }
+#endif
+
+#ifdef _SFORMAT_SSE2
+  for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i))
+  {
+    const uint32_t nonAsciiMask = (uint32_t)_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(value + i)));
+
+    if (nonAsciiMask)
+    {
+      unsigned long index;
+#ifdef _MSC_VER
+      _BitScanForward(&index, nonAsciiMask);
+#else
+      index = (unsigned long)__builtin_ctz(nonAsciiMask);
+#endif
+      return i + index;
+    }
+  }
+#endif
+
+  for (; i < length; i++)
+    if ((uint8_t)value[i] & 0x80)
+      return i;
+
+  return length;
+}
+
+// Counts all bytes that aren't UTF-8 continuation bytes (0b10xxxxxx) until `length` or the first null terminator.
+size_t _sformat_GetStringCount(const char *value, const size_t length)
+{
+  size_t count = 0;
+  size_t i = 0;
+
+#ifdef _SFORMAT_AVX2
+  {
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i firstNonContinuationByte = _mm256_set1_epi8((char)0xC0);
+
+    while (i + sizeof(__m256i) <= length)
+    {
+      // Continuation bytes are counted per byte lane, which can't overflow within 255 iterations.
+      const size_t iterations = _min((length - i) / sizeof(__m256i), (size_t)255);
+      __m256i continuationBytes = zero;
+      size_t j = 0;
+
+      for (; j < iterations; j++)
+      {
+        const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(value + i));
+
+        if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, zero)))
+          break;
+
+        continuationBytes = _mm256_sub_epi8(continuationBytes, _mm256_cmpgt_epi8(firstNonContinuationByte, v));
+        i += sizeof(__m256i);
+      }
+
+      const __m256i sum = _mm256_sad_epu8(continuationBytes, zero);
+      count += j * sizeof(__m256i) - (size_t)(_mm256_extract_epi64(sum, 0) + _mm256_extract_epi64(sum, 1) + _mm256_extract_epi64(sum, 2) + _mm256_extract_epi64(sum, 3));
+
+      if (j < iterations)
+        break;
+    }
+  }
+#endif
+
+#ifdef _SFORMAT_SSE2
+  {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i firstNonContinuationByte = _mm_set1_epi8((char)0xC0);
+
+    while (i + sizeof(__m128i) <= length)
+    {
+      // Continuation bytes are counted per byte lane, which can't overflow within 255 iterations.
+      const size_t iterations = _min((length - i) / sizeof(__m128i), (size_t)255);
+      __m128i continuationBytes = zero;
+      size_t j = 0;
+
+      for (; j < iterations; j++)
+      {
+        const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(value + i));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)))
+          break;
+
+        continuationBytes = _mm_sub_epi8(continuationBytes, _mm_cmplt_epi8(v, firstNonContinuationByte));
+        i += sizeof(__m128i);
+      }
+
+      const __m128i sum = _mm_sad_epu8(continuationBytes, zero);
+      count += j * sizeof(__m128i) - (size_t)(_mm_cvtsi128_si32(sum) + _mm_extract_epi16(sum, 4));
+
+      if (j < iterations)
+        break;
+    }
+  }
+#endif
+
+  for (; i < length && value[i] != '\0'; i++)
+    count += ((uint8_t)value[i] & 0xC0) != 0x80;
+
+  return count;
+}
+
+// Decodes the code point at the start of `value` without validating continuation bytes. Invalid lead bytes & truncated sequences are decoded as U+FFFD.
+inline uint32_t _sformat_DecodeUtf8(const char *value, const size_t length, size_t *pCharSize)
+{
+  const uint8_t *c = reinterpret_cast<const uint8_t *>(value);
+  size_t charSize;
+  uint32_t codePoint;
+
+  if (c[0] < 0x80)
+    charSize = 1, codePoint = c[0];
+  else if ((c[0] & 0xE0) == 0xC0)
+    charSize = 2, codePoint = c[0] & 0x1F;
+  else if ((c[0] & 0xF0) == 0xE0)
+    charSize = 3, codePoint = c[0] & 0x0F;
+  else if ((c[0] & 0xF8) == 0xF0)
+    charSize = 4, codePoint = c[0] & 0x07;
+  else
+    charSize = 1, codePoint = 0xFFFD; // stray continuation byte or invalid lead byte.
+
+  if (charSize > length)
+  {
+    *pCharSize = length;
+    return 0xFFFD;
+  }
+
+  for (size_t i = 1; i < charSize; i++)
+    codePoint = (codePoint << 6) | (c[i] & 0x3F);
+
+  *pCharSize = charSize;
+
+  return codePoint;
+}
+
+// Encodes `codePoint` (which is expected to be a valid code point) as UTF-8 and returns the number of bytes written.
+inline size_t _sformat_EncodeUtf8(const uint32_t codePoint, char *text)
+{
+  if (codePoint < 0x80)
+  {
+    text[0] = (char)codePoint;
+    return 1;
+  }
+  else if (codePoint < 0x800)
+  {
+    text[0] = (char)(0xC0 | (codePoint >> 6));
+    text[1] = (char)(0x80 | (codePoint & 0x3F));
+    return 2;
+  }
+  else if (codePoint < 0x10000)
+  {
+    text[0] = (char)(0xE0 | (codePoint >> 12));
+    text[1] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+    text[2] = (char)(0x80 | (codePoint & 0x3F));
+    return 3;
+  }
+  else
+  {
+    text[0] = (char)(0xF0 | (codePoint >> 18));
+    text[1] = (char)(0x80 | ((codePoint >> 12) & 0x3F));
+    text[2] = (char)(0x80 | ((codePoint >> 6) & 0x3F));
+    text[3] = (char)(0x80 | (codePoint & 0x3F));
+    return 4;
+  }
+}
+
+// Returns the size of the well-formed UTF-8 sequence at the start of `value` or 0 if it's ill-formed, in which case `pInvalidBytes` receives the size of its maximal subpart (which is replaced by a single U+FFFD).
+inline size_t _sformat_GetUtf8SequenceLength(const char *value, const size_t length, size_t *pInvalidBytes)
+{
+  const uint8_t *c = reinterpret_cast<const uint8_t *>(value);
+  size_t charSize;
+  uint8_t minSecondByte = 0x80;
+  uint8_t maxSecondByte = 0xBF;
+
+  if (c[0] < 0x80)
+  {
+    return 1;
+  }
+  else if (c[0] < 0xC2) // stray continuation byte or overlong two byte sequence.
+  {
+    *pInvalidBytes = 1;
+    return 0;
+  }
+  else if (c[0] < 0xE0)
+  {
+    charSize = 2;
+  }
+  else if (c[0] < 0xF0)
+  {
+    charSize = 3;
+
+    if (c[0] == 0xE0) // overlong.
+      minSecondByte = 0xA0;
+    else if (c[0] == 0xED) // surrogates.
+      maxSecondByte = 0x9F;
+  }
+  else if (c[0] < 0xF5)
+  {
+    charSize = 4;
+
+    if (c[0] == 0xF0) // overlong.
+      minSecondByte = 0x90;
+    else if (c[0] == 0xF4) // > U+10FFFF.
+      maxSecondByte = 0x8F;
+  }
+  else
+  {
+    *pInvalidBytes = 1;
+    return 0;
+  }
+
+  if (length < 2 || c[1] < minSecondByte || c[1] > maxSecondByte)
+  {
+    *pInvalidBytes = 1;
+    return 0;
+  }
+
+  for (size_t i = 2; i < charSize; i++)
+  {
+    if (i >= length || (c[i] & 0xC0) != 0x80)
+    {
+      *pInvalidBytes = i;
+      return 0;
+    }
+  }
+
+  return charSize;
+}
+
+#ifdef _SFORMAT_AVX2
+// Lookup tables for the validation algorithm by John Keiser & Daniel Lemire ("Validating UTF-8 In Less Than One Instruction Per Byte"). Every pair of adjacent bytes is classified by the high & low nibble of the first and the high nibble of the second byte. The pair is invalid if all three lookups share an error bit.
+enum _sformat_Utf8Error : uint8_t
+{
+  _sformat_U8E_TooShort = 1 << 0, // lead byte followed by a lead byte or ASCII.
+  _sformat_U8E_TooLong = 1 << 1, // ASCII followed by a continuation byte.
+  _sformat_U8E_Overlong3 = 1 << 2, // 0xE0 followed by 0x80 - 0x9F.
+  _sformat_U8E_TooLarge = 1 << 3, // > U+10FFFF.
+  _sformat_U8E_Surrogate = 1 << 4, // 0xED followed by 0xA0 - 0xBF.
+  _sformat_U8E_Overlong2 = 1 << 5, // 0xC0 or 0xC1.
+  _sformat_U8E_TooLarge1000 = 1 << 6, // > U+10FFFF, followed by 0x80 - 0x8F.
+  _sformat_U8E_Overlong4 = 1 << 6, // 0xF0 followed by 0x80 - 0x8F.
+  _sformat_U8E_TwoContinuations = 1 << 7, // continuation byte followed by a continuation byte (only valid in three & four byte sequences).
+  _sformat_U8E_Carry = _sformat_U8E_TooShort | _sformat_U8E_TooLong | _sformat_U8E_TwoContinuations,
+};
+
+static const uint8_t _sformat_Utf8FirstByteHighNibbleErrors[16] =
+{
+  _sformat_U8E_TooLong, _sformat_U8E_TooLong, _sformat_U8E_TooLong, _sformat_U8E_TooLong,
+  _sformat_U8E_TooLong, _sformat_U8E_TooLong, _sformat_U8E_TooLong, _sformat_U8E_TooLong,
+  _sformat_U8E_TwoContinuations, _sformat_U8E_TwoContinuations, _sformat_U8E_TwoContinuations, _sformat_U8E_TwoContinuations,
+  _sformat_U8E_TooShort | _sformat_U8E_Overlong2,
+  _sformat_U8E_TooShort,
+  _sformat_U8E_TooShort | _sformat_U8E_Overlong3 | _sformat_U8E_Surrogate,
+  _sformat_U8E_TooShort | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000 | _sformat_U8E_Overlong4,
+};
+
+static const uint8_t _sformat_Utf8FirstByteLowNibbleErrors[16] =
+{
+  _sformat_U8E_Carry | _sformat_U8E_Overlong3 | _sformat_U8E_Overlong2 | _sformat_U8E_Overlong4,
+  _sformat_U8E_Carry | _sformat_U8E_Overlong2,
+  _sformat_U8E_Carry,
+  _sformat_U8E_Carry,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000 | _sformat_U8E_Surrogate,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+  _sformat_U8E_Carry | _sformat_U8E_TooLarge | _sformat_U8E_TooLarge1000,
+};
+
+static const uint8_t _sformat_Utf8SecondByteHighNibbleErrors[16] =
+{
+  _sformat_U8E_TooShort, _sformat_U8E_TooShort, _sformat_U8E_TooShort, _sformat_U8E_TooShort,
+  _sformat_U8E_TooShort, _sformat_U8E_TooShort, _sformat_U8E_TooShort, _sformat_U8E_TooShort,
+  _sformat_U8E_TooLong | _sformat_U8E_Overlong2 | _sformat_U8E_TwoContinuations | _sformat_U8E_Overlong3 | _sformat_U8E_TooLarge1000 | _sformat_U8E_Overlong4,
+  _sformat_U8E_TooLong | _sformat_U8E_Overlong2 | _sformat_U8E_TwoContinuations | _sformat_U8E_Overlong3 | _sformat_U8E_TooLarge,
+  _sformat_U8E_TooLong | _sformat_U8E_Overlong2 | _sformat_U8E_TwoContinuations | _sformat_U8E_Surrogate | _sformat_U8E_TooLarge,
+  _sformat_U8E_TooLong | _sformat_U8E_Overlong2 | _sformat_U8E_TwoContinuations | _sformat_U8E_Surrogate | _sformat_U8E_TooLarge,
+  _sformat_U8E_TooShort, _sformat_U8E_TooShort, _sformat_U8E_TooShort, _sformat_U8E_TooShort,
+};
+
+// Returns the bytes of `previous` & `current` starting `N` bytes before `current`.
+template <int N>
+inline __m256i _sformat_PreviousBytes(const __m256i current, const __m256i previous)
+{
+  return _mm256_alignr_epi8(current, _mm256_permute2x128_si256(previous, current, 0x21), 16 - N);
+}
+#endif
+
+// Returns the number of leading bytes (up to `length`) that are well-formed UTF-8. Without AVX2 (the nibble lookups need `pshufb`, which SSE2 lacks), only ASCII runs are skipped in blocks & everything else is decoded code point by code point.
+size_t _sformat_GetValidUtf8PrefixLength(const char *value, const size_t length)
+{
+  size_t i = 0;
+
+#ifdef _SFORMAT_AVX2
+  if (length >= sizeof(__m256i))
+  {
+    const __m256i firstByteHighNibbleErrors = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_sformat_Utf8FirstByteHighNibbleErrors)));
+    const __m256i firstByteLowNibbleErrors = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_sformat_Utf8FirstByteLowNibbleErrors)));
+    const __m256i secondByteHighNibbleErrors = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_sformat_Utf8SecondByteHighNibbleErrors)));
+    const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+    const __m256i thirdByteOffset = _mm256_set1_epi8((char)(0xE0 - 0x80));
+    const __m256i fourthByteOffset = _mm256_set1_epi8((char)(0xF0 - 0x80));
+    const __m256i highBit = _mm256_set1_epi8((char)0x80);
+    const __m256i maxTrailingBytes = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, (char)(0xF0 - 1), (char)(0xE0 - 1), (char)(0xC0 - 1));
+
+    __m256i previous = _mm256_setzero_si256();
+    bool previousIncomplete = false;
+
+    for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i))
+    {
+      const __m256i current = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(value + i));
+
+      if (_mm256_movemask_epi8(current) == 0)
+      {
+        if (previousIncomplete)
+          break;
+
+        previous = current;
+        continue;
+      }
+
+      const __m256i previous1 = _sformat_PreviousBytes<1>(current, previous);
+      const __m256i firstByteHighNibble = _mm256_and_si256(_mm256_srli_epi16(previous1, 4), lowNibble);
+      const __m256i firstByteLowNibble = _mm256_and_si256(previous1, lowNibble);
+      const __m256i secondByteHighNibble = _mm256_and_si256(_mm256_srli_epi16(current, 4), lowNibble);
+
+      const __m256i errors = _mm256_and_si256(_mm256_and_si256(_mm256_shuffle_epi8(firstByteHighNibbleErrors, firstByteHighNibble), _mm256_shuffle_epi8(firstByteLowNibbleErrors, firstByteLowNibble)), _mm256_shuffle_epi8(secondByteHighNibbleErrors, secondByteHighNibble));
+
+      // Continuation bytes that follow two or three bytes after a three or four byte lead byte are expected to be flagged as `_sformat_U8E_TwoContinuations`.
+      const __m256i isThirdOrFourthByte = _mm256_and_si256(_mm256_or_si256(_mm256_subs_epu8(_sformat_PreviousBytes<2>(current, previous), thirdByteOffset), _mm256_subs_epu8(_sformat_PreviousBytes<3>(current, previous), fourthByteOffset)), highBit);
+
+      const __m256i error = _mm256_xor_si256(errors, isThirdOrFourthByte);
+
+      if (!_mm256_testz_si256(error, error))
+        break;
+
+      previous = current;
+      previousIncomplete = !_mm256_testz_si256(_mm256_subs_epu8(current, maxTrailingBytes), _mm256_subs_epu8(current, maxTrailingBytes));
+    }
+
+    // The last code point before `i` may continue in the following block, so the scalar path restarts at its lead byte.
+    for (size_t j = 1; j <= 3 && j <= i; j++)
+    {
+      if (((uint8_t)value[i - j] & 0xC0) != 0x80)
+      {
+        i -= j;
+        break;
+      }
+    }
+  }
+#endif
+
+  while (true)
+  {
+    i += _sformat_GetAsciiPrefixLength(value + i, length - i);
+
+    if (i == length)
+      return length;
+
+    size_t invalidBytes = 0;
+    const size_t charSize = _sformat_GetUtf8SequenceLength(value + i, length - i, &invalidBytes);
+
+    if (charSize == 0)
+      return i;
+
+    i += charSize;
+  }
+}
+
+// Copies `value` to `text`, replacing the maximal subparts of ill-formed UTF-8 sequences by U+FFFD. `validBytes` is the length of the well-formed prefix of `value`.
+size_t _sformat_RepairUtf8(const char *value, const size_t length, size_t validBytes, char *text)
+{
+  char *originalTextPosition = text;
+  size_t i = 0;
+
+  while (true)
+  {
+    memcpy(text, value + i, validBytes);
+    text += validBytes;
+    i += validBytes;
+
+    if (i == length)
+      break;
+
+    size_t invalidBytes = 0;
+    _sformat_GetUtf8SequenceLength(value + i, length - i, &invalidBytes);
+
+    text += _sformat_EncodeUtf8(0xFFFD, text);
+    i += invalidBytes;
+
+    validBytes = _sformat_GetValidUtf8PrefixLength(value + i, length - i);
+  }
+
+  return text - originalTextPosition;
+}
+
+size_t _sformat_GetRepairedStringColumns(const char *value, const size_t length, const sformatState &fs)
+{
+  size_t columns = 0;
+  size_t i = 0;
+
+  while (true)
+  {
+    const size_t validBytes = _sformat_GetValidUtf8PrefixLength(value + i, length - i);
+
+    columns += _sformat_GetEscapedStringColumns(value + i, validBytes, fs);
+    i += validBytes;
+
+    if (i == length)
+      break;
+
+    size_t invalidBytes = 0;
+    _sformat_GetUtf8SequenceLength(value + i, length - i, &invalidBytes);
+
+    columns++; // U+FFFD is a single code point & terminal column.
+    i += invalidBytes;
+  }
+
+  return columns;
+}
+
+inline uint8_t _sformat_GetCodePointDisplayWidth(const uint32_t codePoint)
+{
+  if (codePoint < 0x20000)
+    return (_sformat_DisplayWidthBlocks[_sformat_DisplayWidthBlockIndex[codePoint >> 7]][(codePoint & 127) >> 2] >> ((codePoint & 3) * 2)) & 3;
+  else if (codePoint < 0x40000)
+    return 2;
+  else if (codePoint >= 0xE0000 && codePoint < 0xE1000) // tags & variation selectors supplement.
+    return 0;
+  else
+    return 1;
+}
+
+// Returns the number of bytes of the longest prefix of `value` that fits into `maxColumns` terminal columns (including any zero width code points following it) and stores the columns it takes up in `pColumns`.
+size_t _sformat_GetDisplayWidthPrefixLength(const char *value, const size_t length, const size_t maxColumns, size_t *pColumns)
+{
+  size_t columns = 0;
+  size_t i = 0;
+  uint8_t previousWidth = 0;
+  bool previousWasZeroWidthJoiner = false;
+
+  while (i < length)
+  {
+    const size_t asciiBytes = _sformat_GetAsciiPrefixLength(value + i, _min(length - i, maxColumns - columns));
+
+    if (asciiBytes)
+    {
+      i += asciiBytes;
+      columns += asciiBytes;
+      previousWidth = 1;
+      previousWasZeroWidthJoiner = false;
+
+      if (i == length)
+        break;
+    }
+
+    size_t charSize;
+    const uint32_t codePoint = _sformat_DecodeUtf8(value + i, length - i, &charSize);
+
+    uint8_t width = _sformat_GetCodePointDisplayWidth(codePoint);
+
+    if (previousWasZeroWidthJoiner) // emoji zwj sequences are displayed as a single glyph.
+      width = 0;
+    else if (codePoint >= 0x1F3FB && codePoint <= 0x1F3FF && previousWidth == 2) // skin tone modifiers are merged into the preceding emoji.
+      width = 0;
+    else if (codePoint == 0xFE0F && previousWidth == 1) // emoji presentation selectors widen the preceding narrow character.
+      width = 1;
+
+    if (columns + width > maxColumns)
+      break;
+
+    columns += width;
+    i += charSize;
+    previousWasZeroWidthJoiner = (codePoint == 0x200D);
+
+    if (width != 0)
+      previousWidth = (codePoint == 0xFE0F) ? 2 : width;
+  }
+
+  *pColumns = columns;
+
+  return i;
+}
+
+size_t _sformat_GetStringDisplayWidth(const char *value, const size_t length)
+{
+  size_t columns;
+  _sformat_GetDisplayWidthPrefixLength(value, length, (size_t)-1, &columns);
+
+  return columns;
+}
+
+enum _sformat_GraphemeBreakProperty : uint8_t
+{
+  _sformat_GBP_Other,
+  _sformat_GBP_CR,
+  _sformat_GBP_LF,
+  _sformat_GBP_Control,
+  _sformat_GBP_Extend,
+  _sformat_GBP_ZWJ,
+  _sformat_GBP_RegionalIndicator,
+  _sformat_GBP_Prepend,
+  _sformat_GBP_SpacingMark,
+  _sformat_GBP_L,
+  _sformat_GBP_V,
+  _sformat_GBP_T,
+  _sformat_GBP_LV,
+  _sformat_GBP_LVT,
+  _sformat_GBP_ExtendedPictographic,
+};
+
+inline _sformat_GraphemeBreakProperty _sformat_GetGraphemeBreakProperty(const uint32_t codePoint)
+{
+  if (codePoint < 0x20000)
+    return (_sformat_GraphemeBreakProperty)((_sformat_GraphemeBreakBlocks[_sformat_GraphemeBreakBlockIndex[codePoint >> 7]][(codePoint & 127) >> 1] >> ((codePoint & 1) * 4)) & 0xF);
+  else if (codePoint < 0xE0000 || codePoint >= 0xE1000)
+    return _sformat_GBP_Other;
+  else if ((codePoint >= 0xE0020 && codePoint < 0xE0080) || (codePoint >= 0xE0100 && codePoint < 0xE01F0)) // tags & variation selectors supplement.
+    return _sformat_GBP_Extend;
+  else
+    return _sformat_GBP_Control;
+}
+
+struct _sformat_GraphemeBreakState
+{
+  _sformat_GraphemeBreakProperty previous = _sformat_GBP_Control;
+  bool inEmojiSequence = false; // Extended_Pictographic Extend*
+  bool afterEmojiZwj = false; // Extended_Pictographic Extend* ZWJ
+  bool oddRegionalIndicators = false;
+};
+
+// Returns whether there's an extended grapheme cluster boundary (UAX #29) before a code point with the given property and advances the state.
+inline bool _sformat_IsGraphemeClusterBoundary(_sformat_GraphemeBreakState &state, const _sformat_GraphemeBreakProperty property)
+{
+  const _sformat_GraphemeBreakProperty previous = state.previous;
+  bool isBoundary;
+
+  if (previous == _sformat_GBP_CR && property == _sformat_GBP_LF) // GB3
+    isBoundary = false;
+  else if ((previous >= _sformat_GBP_CR && previous <= _sformat_GBP_Control) || (property >= _sformat_GBP_CR && property <= _sformat_GBP_Control)) // GB4, GB5
+    isBoundary = true;
+  else if (previous == _sformat_GBP_L && (property == _sformat_GBP_L || property == _sformat_GBP_V || property == _sformat_GBP_LV || property == _sformat_GBP_LVT)) // GB6
+    isBoundary = false;
+  else if ((previous == _sformat_GBP_LV || previous == _sformat_GBP_V) && (property == _sformat_GBP_V || property == _sformat_GBP_T)) // GB7
+    isBoundary = false;
+  else if ((previous == _sformat_GBP_LVT || previous == _sformat_GBP_T) && property == _sformat_GBP_T) // GB8
+    isBoundary = false;
+  else if (property == _sformat_GBP_Extend || property == _sformat_GBP_ZWJ || property == _sformat_GBP_SpacingMark || previous == _sformat_GBP_Prepend) // GB9, GB9a, GB9b
+    isBoundary = false;
+  else if (state.afterEmojiZwj && property == _sformat_GBP_ExtendedPictographic) // GB11
+    isBoundary = false;
+  else if (state.oddRegionalIndicators && property == _sformat_GBP_RegionalIndicator) // GB12, GB13
+    isBoundary = false;
+  else // GB999
+    isBoundary = true;
+
+  state.afterEmojiZwj = state.inEmojiSequence && property == _sformat_GBP_ZWJ;
+  state.inEmojiSequence = property == _sformat_GBP_ExtendedPictographic || (state.inEmojiSequence && property == _sformat_GBP_Extend);
+  state.oddRegionalIndicators = property == _sformat_GBP_RegionalIndicator && !state.oddRegionalIndicators;
+  state.previous = property;
+
+  return isBoundary;
+}
+
+// Returns the last extended grapheme cluster boundary in `value` at or before `position`, which is expected to be at the start of a code point.
+size_t _sformat_GetGraphemeClusterBoundary(const char *value, const size_t length, const size_t position)
+{
+  if (position >= length)
+    return length;
+
+  _sformat_GraphemeBreakState state;
+  size_t boundary = 0;
+  size_t i = 0;
+
+  // Invalid UTF-8 sequences may step over `position`.
+  while (i < position)
+  {
+    const size_t asciiBytes = _sformat_GetAsciiPrefixLength(value + i, position - i);
+
+    if (asciiBytes > 1)
+    {
+      // Within ASCII runs every position is a boundary, except between CR & LF.
+      if (_sformat_IsGraphemeClusterBoundary(state, _sformat_GetGraphemeBreakProperty((uint8_t)value[i])))
+        boundary = i;
+
+      i += asciiBytes;
+      boundary = _max(boundary, i - 1 - (size_t)(value[i - 2] == '\r' && value[i - 1] == '\n'));
+
+      state = _sformat_GraphemeBreakState();
+      state.previous = _sformat_GetGraphemeBreakProperty((uint8_t)value[i - 1]);
+    }
+
+    if (i >= position)
+      break;
+
+    size_t charSize;
+    const uint32_t codePoint = _sformat_DecodeUtf8(value + i, length - i, &charSize);
+
+    if (_sformat_IsGraphemeClusterBoundary(state, _sformat_GetGraphemeBreakProperty(codePoint)))
+      boundary = i;
 
-size_t _sformat_GetStringCount(const char *value, const size_t length)
-{
-  return utf8_strnlen(value, length);
+    i += charSize;
+  }
+
+  if (i > position)
+    return boundary;
+
+  // Is `position` itself a boundary?
+  size_t charSize;
+  const uint32_t codePoint = _sformat_DecodeUtf8(value + position, length - position, &charSize);
+
+  return _sformat_IsGraphemeClusterBoundary(state, _sformat_GetGraphemeBreakProperty(codePoint)) ? position : boundary;
 }
 
 static const class _sformat_LocaleSetter
@@ -3797,7 +5364,7 @@ void _sformat_Append_DecimalDigitsWithGroupDigitsNoSign_Internal(const size_t nu
 void _sformat_Append_DisplayWithAlignNoGroupingWithSign_Internal(const size_t totalBytes, const size_t signChars, const char signChar, const size_t numberBytes, char *text, const char *buffer, const sformatState &fs);
 size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, const size_t maxChars, char *text, const char *buffer, const sformatState &fs, const bool isNumber);
 size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, char *text, const char *buffer, const sformatState &fs);
-size_t _sformat_Append_DecimalFloat(const bool negative, const char signChar, const size_t signChars, const size_t digits, char *buffer, const int64_t exponent, const sformatState &fs, char *text);
+size_t _sformat_Append_DecimalFloat(const bool negative, const char signChar, const size_t signChars, const size_t digits, char *buffer, const int64_t exponent, const size_t fractionalDigits, const sformatState &fs, char *text);
 size_t _sformat_Append_DecimalFloatScientific(const bool negative, const char signChar, const size_t signChars, const size_t digits, const char *buffer, const size_t decimalSeparatorPosition, const char *exponentBuffer, const size_t exponentLength, const size_t fractionalDigits, const sformatState &fs, char *text);
 
 //////////////////////////////////////////////////////////////////////////
@@ -3873,7 +5440,7 @@ size_t _sformat_Append(const int64_t value, const sformatState &fs, char *text)
     }
     }
 
-    char buffer[19];
+    char buffer[19 + 1]; // + 1 for potential rounding with `decimalScale`.
     char *pBuffer = &buffer[std::size(buffer) - 1];
 
     int64_t negativeAbs = value < 0 ? value : -value; // because otherwise the minimum value couldn't be converted to a valid signed equivalent.
@@ -3918,6 +5485,9 @@ size_t _sformat_Append(const int64_t value, const sformatState &fs, char *text)
       pBuffer++;
     }
 
+    if (fs.decimalScale != 0)
+      return _sformat_Append_DecimalFloat(value < 0, signChar, signChars, numberBytes, pBuffer, -(int64_t)fs.decimalScale, fs.fractionalDigits, fs, text);
+
     return _sformat_Append_Decimal(value < 0, signChar, signChars, numberBytes, pBuffer, fs, text);
   }
 
@@ -3957,7 +5527,7 @@ size_t _sformat_Append(const uint64_t value, const sformatState &fs, char *text)
       break;
     }
 
-    char buffer[20];
+    char buffer[20 + 1]; // + 1 for potential rounding with `decimalScale`.
     char *pBuffer = &buffer[std::size(buffer) - 1];
     uint64_t tmp = value;
 
@@ -3987,6 +5557,9 @@ size_t _sformat_Append(const uint64_t value, const sformatState &fs, char *text)
       pBuffer++;
     }
 
+    if (fs.decimalScale != 0)
+      return _sformat_Append_DecimalFloat(false, signChar, signChars, numberBytes, pBuffer, -(int64_t)fs.decimalScale, fs.fractionalDigits, fs, text);
+
     return _sformat_Append_Decimal(false, signChar, signChars, numberBytes, pBuffer, fs, text);
   }
 
@@ -4052,9 +5625,543 @@ size_t _sformat_Append(const uint64_t value, const sformatState &fs, char *text)
   }
 }
 
+// Besides control characters, up to three other characters need escaping. Unused ones repeat `\0`, which is a control character anyways.
+static const char _sformat_EscapedChars[][3] =
+{
+  { '\0', '\0', '\0' }, // FEO_None
+  { '"', '\\', '\0' }, // FEO_Json
+  { '"', '\\', '\x7F' }, // FEO_C
+  { '\x7F', '\0', '\0' }, // FEO_Control
+};
+
+inline bool _sformat_RequiresEscaping(const char c, const sformatEscapeOption escape)
+{
+  return (uint8_t)c < 0x20 || c == _sformat_EscapedChars[escape][0] || c == _sformat_EscapedChars[escape][1] || c == _sformat_EscapedChars[escape][2];
+}
+
+// Returns the number of leading bytes (up to `length`) that don't need to be escaped.
+size_t _sformat_GetUnescapedPrefixLength(const char *value, const size_t length, const sformatEscapeOption escape)
+{
+  size_t i = 0;
+
+#ifdef _SFORMAT_AVX2
+  {
+    const __m256i lastControlChar = _mm256_set1_epi8(0x1F);
+    const __m256i escaped0 = _mm256_set1_epi8(_sformat_EscapedChars[escape][0]);
+    const __m256i escaped1 = _mm256_set1_epi8(_sformat_EscapedChars[escape][1]);
+    const __m256i escaped2 = _mm256_set1_epi8(_sformat_EscapedChars[escape][2]);
+
+    for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i))
+    {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(value + i));
+      const __m256i isControlChar = _mm256_cmpeq_epi8(_mm256_min_epu8(v, lastControlChar), v);
+      const __m256i isEscapedChar = _mm256_or_si256(_mm256_cmpeq_epi8(v, escaped0), _mm256_or_si256(_mm256_cmpeq_epi8(v, escaped1), _mm256_cmpeq_epi8(v, escaped2)));
+      const uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_or_si256(isControlChar, isEscapedChar));
+
+      if (mask)
+      {
+        unsigned long index;
+#ifdef _MSC_VER
+        _BitScanForward(&index, mask);
+#else
+        index = (unsigned long)__builtin_ctz(mask);
+#endif
+        return i + index;
+      }
+    }
+  }
+#endif
+
+#ifdef _SFORMAT_SSE2
+  {
+    const __m128i lastControlChar = _mm_set1_epi8(0x1F);
+    const __m128i escaped0 = _mm_set1_epi8(_sformat_EscapedChars[escape][0]);
+    const __m128i escaped1 = _mm_set1_epi8(_sformat_EscapedChars[escape][1]);
+    const __m128i escaped2 = _mm_set1_epi8(_sformat_EscapedChars[escape][2]);
+
+    for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i))
+    {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(value + i));
+      const __m128i isControlChar = _mm_cmpeq_epi8(_mm_min_epu8(v, lastControlChar), v);
+      const __m128i isEscapedChar = _mm_or_si128(_mm_cmpeq_epi8(v, escaped0), _mm_or_si128(_mm_cmpeq_epi8(v, escaped1), _mm_cmpeq_epi8(v, escaped2)));
+      const uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_or_si128(isControlChar, isEscapedChar));
+
+      if (mask)
+      {
+        unsigned long index;
+#ifdef _MSC_VER
+        _BitScanForward(&index, mask);
+#else
+        index = (unsigned long)__builtin_ctz(mask);
+#endif
+        return i + index;
+      }
+    }
+  }
+#endif
+
+  for (; i < length; i++)
+    if (_sformat_RequiresEscaping(value[i], escape))
+      return i;
+
+  return length;
+}
+
+// Writes the escape sequence for `c` (which requires escaping) and returns its length.
+size_t _sformat_EscapeChar(const char c, const sformatEscapeOption escape, char *text)
+{
+  constexpr char hexDigits[] = "0123456789ABCDEF";
+  constexpr char lowerHexDigits[] = "0123456789abcdef";
+
+  text[0] = '\\';
+
+  switch (c)
+  {
+  case '"': text[1] = '"'; return 2;
+  case '\\': text[1] = '\\'; return 2;
+  case '\n': text[1] = 'n'; return 2;
+  case '\r': text[1] = 'r'; return 2;
+  case '\t': text[1] = 't'; return 2;
+  }
+
+  switch (escape)
+  {
+  default:
+  case FEO_Json:
+  {
+    switch (c)
+    {
+    case '\b': text[1] = 'b'; return 2;
+    case '\f': text[1] = 'f'; return 2;
+    }
+
+    text[1] = 'u';
+    text[2] = '0';
+    text[3] = '0';
+    text[4] = lowerHexDigits[(uint8_t)c >> 4];
+    text[5] = lowerHexDigits[(uint8_t)c & 0xF];
+    return 6;
+  }
+
+  case FEO_C:
+  {
+    switch (c)
+    {
+    case '\a': text[1] = 'a'; return 2;
+    case '\b': text[1] = 'b'; return 2;
+    case '\f': text[1] = 'f'; return 2;
+    case '\v': text[1] = 'v'; return 2;
+    }
+
+    // Octal escapes always end after three digits, unlike hexadecimal ones.
+    text[1] = (char)('0' + (((uint8_t)c >> 6) & 7));
+    text[2] = (char)('0' + (((uint8_t)c >> 3) & 7));
+    text[3] = (char)('0' + ((uint8_t)c & 7));
+    return 4;
+  }
+
+  case FEO_Control:
+  {
+    text[1] = 'x';
+    text[2] = hexDigits[(uint8_t)c >> 4];
+    text[3] = hexDigits[(uint8_t)c & 0xF];
+    return 4;
+  }
+  }
+}
+
+size_t _sformat_EscapeString(const char *value, const size_t length, const sformatEscapeOption escape, char *text)
+{
+  char *originalTextPosition = text;
+  size_t i = 0;
+
+  while (true)
+  {
+    const size_t unescapedBytes = _sformat_GetUnescapedPrefixLength(value + i, length - i, escape);
+
+    memcpy(text, value + i, unescapedBytes);
+    text += unescapedBytes;
+    i += unescapedBytes;
+
+    if (i == length)
+      break;
+
+    text += _sformat_EscapeChar(value[i], escape, text);
+    i++;
+  }
+
+  return text - originalTextPosition;
+}
+
+size_t _sformat_GetStringEscapeOverhead(const char *value, const size_t length, const sformatEscapeOption escape)
+{
+  char buffer[_sformat_MaxEscapedBytesPerByte(FEO_Json)];
+  size_t overhead = 0;
+  size_t i = 0;
+
+  while (true)
+  {
+    i += _sformat_GetUnescapedPrefixLength(value + i, length - i, escape);
+
+    if (i == length)
+      break;
+
+    overhead += _sformat_EscapeChar(value[i], escape, buffer) - 1;
+    i++;
+  }
+
+  return overhead;
+}
+
+size_t _sformat_AppendEscapedStringWithLength(const char *value, const size_t length, const sformatState &fs, char *text)
+{
+  if (fs.stringEscape == FEO_None)
+    return _sformat_Append_DisplayWithAlign_Internal(length, text, value, fs);
+
+  const size_t maxEscapedBytes = length * _sformat_MaxEscapedBytesPerByte(fs.stringEscape);
+
+  if (fs.minChars == 0 && fs.maxChars >= maxEscapedBytes)
+    return _sformat_EscapeString(value, length, fs.stringEscape, text);
+
+  // Strings that may have to be padded or truncated are escaped behind the output (`_sformat_GetEscapedStringMaxBytes` reserves space for that) and aligned into place from there.
+  char *buffer = text + _sformat_GetAlignedStringMaxBytes(maxEscapedBytes, fs);
+  const size_t bytes = _sformat_EscapeString(value, length, fs.stringEscape, buffer);
+
+  return _sformat_Append_DisplayWithAlign_Internal(bytes, text, buffer, fs);
+}
+
+// Converts the case of the ASCII letters in `value` to `text` (which may overlap `value`, as long as it doesn't start behind it) & returns the number of leading bytes (up to `length`) that were ASCII.
+size_t _sformat_ConvertAsciiCase(const char *value, const size_t length, const sformatCaseOption caseOption, char *text)
+{
+  // Upper & lower case ASCII letters only differ in 0x20.
+  const char first = caseOption == FCO_Upper ? 'a' : 'A';
+  const char last = caseOption == FCO_Upper ? 'z' : 'Z';
+  size_t i = 0;
+
+#ifdef _SFORMAT_AVX2
+  {
+    const __m256i beforeFirst = _mm256_set1_epi8(first - 1);
+    const __m256i afterLast = _mm256_set1_epi8(last + 1);
+    const __m256i caseBit = _mm256_set1_epi8(0x20);
+
+    for (; i + sizeof(__m256i) <= length; i += sizeof(__m256i))
+    {
+      const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(value + i));
+
+      // Non-ASCII bytes are negative as signed chars & therefore never in range. They're stored as well, but overwritten by the caller.
+      const __m256i isLetter = _mm256_and_si256(_mm256_cmpgt_epi8(v, beforeFirst), _mm256_cmpgt_epi8(afterLast, v));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(text + i), _mm256_xor_si256(v, _mm256_and_si256(isLetter, caseBit)));
+
+      const uint32_t nonAsciiMask = (uint32_t)_mm256_movemask_epi8(v);
+
+      if (nonAsciiMask)
+      {
+        unsigned long index;
+#ifdef _MSC_VER
+        _BitScanForward(&index, nonAsciiMask);
+#else
+        index = (unsigned long)__builtin_ctz(nonAsciiMask);
+#endif
+        return i + index;
+      }
+    }
+  }
+#endif
+
+#ifdef _SFORMAT_SSE2
+  {
+    const __m128i beforeFirst = _mm_set1_epi8(first - 1);
+    const __m128i afterLast = _mm_set1_epi8(last + 1);
+    const __m128i caseBit = _mm_set1_epi8(0x20);
+
+    for (; i + sizeof(__m128i) <= length; i += sizeof(__m128i))
+    {
+      const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(value + i));
+
+      // Non-ASCII bytes are negative as signed chars & therefore never in range. They're stored as well, but overwritten by the caller.
+      const __m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(v, beforeFirst), _mm_cmplt_epi8(v, afterLast));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(text + i), _mm_xor_si128(v, _mm_and_si128(isLetter, caseBit)));
+
+      const uint32_t nonAsciiMask = (uint32_t)_mm_movemask_epi8(v);
+
+      if (nonAsciiMask)
+      {
+        unsigned long index;
+#ifdef _MSC_VER
+        _BitScanForward(&index, nonAsciiMask);
+#else
+        index = (unsigned long)__builtin_ctz(nonAsciiMask);
+#endif
+        return i + index;
+      }
+    }
+  }
+#endif
+
+  for (; i < length; i++)
+  {
+    const char c = value[i];
+
+    if ((uint8_t)c & 0x80)
+      return i;
+
+    text[i] = (c >= first && c <= last) ? (char)(c ^ 0x20) : c;
+  }
+
+  return length;
+}
+
+// Converts the case of `value` to `text` & returns the number of bytes written (which is never more than `length`). Letters outside of the mapped ranges & invalid UTF-8 sequences are copied unchanged.
+size_t _sformat_ConvertCase(const char *value, const size_t length, const sformatCaseOption caseOption, char *text)
+{
+  const int16_t *offsets = caseOption == FCO_Upper ? _sformat_UpperCaseOffsets : _sformat_LowerCaseOffsets;
+  char *originalTextPosition = text;
+  size_t i = 0;
+
+  while (true)
+  {
+    const size_t asciiBytes = _sformat_ConvertAsciiCase(value + i, length - i, caseOption, text);
+    text += asciiBytes;
+    i += asciiBytes;
+
+    if (i == length)
+      break;
+
+    const uint8_t *c = reinterpret_cast<const uint8_t *>(value + i);
+
+    // All mapped code points are two byte sequences. Overlong sequences (lead bytes 0xC0 & 0xC1) aren't decoded, as re-encoding them would turn them into ASCII characters like '"' or '/'.
+    if ((c[0] & 0xE0) == 0xC0 && c[0] >= 0xC2 && i + 1 < length && (c[1] & 0xC0) == 0x80)
+    {
+      const uint32_t codePoint = ((c[0] & 0x1F) << 6) | (c[1] & 0x3F);
+
+      if (codePoint >= 0x80 && codePoint < 0x530)
+        text += _sformat_EncodeUtf8((uint32_t)((int32_t)codePoint + offsets[codePoint - 0x80]), text);
+      else
+        text += _sformat_EncodeUtf8(codePoint, text);
+
+      i += 2;
+    }
+    else
+    {
+      *text = value[i];
+      text++;
+      i++;
+    }
+  }
+
+  return text - originalTextPosition;
+}
+
+size_t _sformat_AppendCaseConvertedStringWithLength(const char *value, const size_t length, const sformatState &fs, char *text)
+{
+  if (fs.stringCase == FCO_None)
+    return _sformat_AppendEscapedStringWithLength(value, length, fs, text);
+
+  if (fs.minChars == 0 && fs.maxChars >= length && fs.stringEscape == FEO_None)
+    return _sformat_ConvertCase(value, length, fs.stringCase, text);
+
+  // Strings that may have to be padded, truncated or escaped are converted behind the output (`_sformat_GetCaseConvertedStringMaxBytes` reserves space for that) and appended from there.
+  char *buffer = text + _sformat_GetEscapedStringMaxBytes(length, fs);
+  const size_t bytes = _sformat_ConvertCase(value, length, fs.stringCase, buffer);
+
+  return _sformat_AppendEscapedStringWithLength(buffer, bytes, fs, text);
+}
+
 size_t _sformat_AppendStringWithLength(const char *value, const size_t length, const sformatState &fs, char *text)
 {
-  return _sformat_Append_DisplayWithAlign_Internal(length, text, value, fs);
+  if (!fs.stringValidateUtf8)
+    return _sformat_AppendCaseConvertedStringWithLength(value, length, fs, text);
+
+  const size_t validBytes = _sformat_GetValidUtf8PrefixLength(value, length);
+
+  if (validBytes == length)
+    return _sformat_AppendCaseConvertedStringWithLength(value, length, fs, text);
+
+  const size_t maxRepairedBytes = length * _sformat_MaxRepairedBytesPerByte;
+
+  if (fs.minChars == 0 && fs.maxChars >= maxRepairedBytes && fs.stringEscape == FEO_None && fs.stringCase == FCO_None)
+    return _sformat_RepairUtf8(value, length, validBytes, text);
+
+  // Strings that may have to be padded, truncated, converted or escaped are repaired behind the output (`_sformat_GetStringMaxBytes` reserves space for that) and appended from there.
+  char *buffer = text + _sformat_GetCaseConvertedStringMaxBytes(maxRepairedBytes, fs);
+  const size_t bytes = _sformat_RepairUtf8(value, length, validBytes, buffer);
+
+  return _sformat_AppendCaseConvertedStringWithLength(buffer, bytes, fs, text);
+}
+
+bool _sformat_StreamFlush(_sformatStream &stream)
+{
+  if (stream.position == 0)
+    return true;
+
+  const size_t length = stream.position;
+  stream.position = 0;
+
+  return stream.sink.flush(stream.sink.pUserData, stream.sink.chunk, length);
+}
+
+bool _sformat_StreamText(_sformatStream &stream, const char *text, const size_t length)
+{
+  if (!_sformat_StreamFlush(stream))
+    return false;
+
+  // Passed on in chunk sized pieces, as if it had been formatted into the chunk.
+  for (size_t i = 0; i < length; i += stream.sink.capacity)
+    if (!stream.sink.flush(stream.sink.pUserData, text + i, _min(length - i, stream.sink.capacity)))
+      return false;
+
+  return true;
+}
+
+// Returns the largest number of bytes of a string that can be formatted into `capacity` bytes (or 0 if that's not enough for a complete code point).
+size_t _sformat_GetMaxStringPieceLength(const size_t capacity, const sformatState &fs)
+{
+  size_t maxPieceLength = capacity;
+
+  // Escaped or repaired strings may take up multiple times their length.
+  while (_sformat_GetStringMaxBytes(maxPieceLength, fs) > capacity)
+    maxPieceLength /= 2;
+
+  return maxPieceLength < 4 ? 0 : maxPieceLength;
+}
+
+// Pieces never end in the middle of a UTF-8 sequence, so they can be validated, converted & escaped on their own.
+size_t _sformat_GetStringPieceLength(const char *value, const size_t length, const size_t maxPieceLength)
+{
+  if (length <= maxPieceLength)
+    return length;
+
+  size_t pieceLength = maxPieceLength;
+
+  for (size_t j = 0; j < 3 && ((uint8_t)value[pieceLength] & 0xC0) == 0x80; j++)
+    pieceLength--;
+
+  return pieceLength;
+}
+
+bool _sformat_StreamString(_sformatStream &stream, const char *value, const size_t length, const sformatState &fs)
+{
+  const size_t maxPieceLength = _sformat_GetMaxStringPieceLength(stream.sink.capacity, fs);
+
+  if (maxPieceLength == 0)
+    return false;
+
+  for (size_t i = 0; i < length;)
+  {
+    const size_t pieceLength = _sformat_GetStringPieceLength(value + i, length - i, maxPieceLength);
+
+    if (_sformat_GetStringMaxBytes(pieceLength, fs) > stream.sink.capacity - stream.position && !_sformat_StreamFlush(stream))
+      return false;
+
+    stream.position += _sformat_AppendStringWithLength(value + i, pieceLength, fs, stream.sink.chunk + stream.position);
+    i += pieceLength;
+  }
+
+  return true;
+}
+
+bool _sformat_BoundedCopy(_sformatBoundedWriter &writer, const char *text, const size_t length)
+{
+  const size_t remaining = writer.limit - writer.position;
+
+  if (length > remaining)
+  {
+    memcpy(writer.destination + writer.position, text, remaining);
+    writer.position = writer.limit;
+
+    return false;
+  }
+
+  memcpy(writer.destination + writer.position, text, length);
+  writer.position += length;
+
+  return true;
+}
+
+bool _sformat_BoundedAppendString(_sformatBoundedWriter &writer, const char *value, const size_t length, const sformatState &fs)
+{
+  const size_t maxPieceLength = _sformat_GetMaxStringPieceLength(_sformat_BoundedScratchBytes, fs);
+
+  if (maxPieceLength == 0)
+    return false;
+
+  for (size_t i = 0; i < length;)
+  {
+    const size_t pieceLength = _sformat_GetStringPieceLength(value + i, length - i, maxPieceLength);
+
+    if (_sformat_GetStringMaxBytes(pieceLength, fs) <= writer.limit - writer.position)
+    {
+      writer.position += _sformat_AppendStringWithLength(value + i, pieceLength, fs, writer.destination + writer.position);
+    }
+    else
+    {
+      char scratch[_sformat_BoundedScratchBytes];
+
+      if (!_sformat_BoundedCopy(writer, scratch, _sformat_AppendStringWithLength(value + i, pieceLength, fs, scratch)))
+        return false;
+    }
+
+    i += pieceLength;
+  }
+
+  return true;
+}
+
+void _sformat_BoundedTruncate(_sformatBoundedWriter &writer, const sformatState &fs)
+{
+  size_t markerLength = _min(fs.truncationMarkerLength, sizeof(fs.truncationMarkerChars));
+
+  // The marker is either written completely or not at all.
+  if (markerLength > writer.limit)
+    markerLength = 0;
+
+  size_t position = _min(writer.position, writer.limit - markerLength);
+
+  // The output may have been cut anywhere (by the marker or `_sformat_BoundedCopy`), so it mustn't end with an incomplete UTF-8 sequence.
+  size_t sequenceStart = position;
+
+  while (sequenceStart > 0 && position - sequenceStart < 3 && ((uint8_t)writer.destination[sequenceStart - 1] & 0xC0) == 0x80)
+    sequenceStart--;
+
+  if (sequenceStart > 0)
+  {
+    const uint8_t leadByte = (uint8_t)writer.destination[sequenceStart - 1];
+    const size_t sequenceLength = leadByte < 0xC0 ? 1 : (leadByte < 0xE0 ? 2 : (leadByte < 0xF0 ? 3 : 4));
+
+    if (position - (sequenceStart - 1) < sequenceLength)
+      position = sequenceStart - 1;
+  }
+
+  memcpy(writer.destination + position, fs.truncationMarkerChars, markerLength);
+  writer.position = position + markerLength;
+}
+
+void _sformat_IOVecReference(_sformatIOVecWriter &writer, const char *value, const size_t length)
+{
+  if (writer.position != writer.pieceStart)
+  {
+    writer.pVectors[writer.count].iov_base = writer.text + writer.pieceStart;
+    writer.pVectors[writer.count].iov_len = writer.position - writer.pieceStart;
+    writer.count++;
+
+    writer.pieceStart = writer.position;
+  }
+
+  writer.pVectors[writer.count].iov_base = const_cast<char *>(value);
+  writer.pVectors[writer.count].iov_len = length;
+  writer.count++;
+}
+
+void _sformat_IOVecFinish(_sformatIOVecWriter &writer)
+{
+  if (writer.position == writer.pieceStart)
+    return;
+
+  writer.pVectors[writer.count].iov_base = writer.text + writer.pieceStart;
+  writer.pVectors[writer.count].iov_len = writer.position - writer.pieceStart;
+  writer.count++;
+
+  writer.pieceStart = writer.position;
 }
 
 size_t _sformat_AppendInplaceString(const char *string, const size_t count, const size_t length, const sformatState &fs, char *text)
@@ -4065,7 +6172,24 @@ size_t _sformat_AppendInplaceString(const char *string, const size_t count, cons
   return _sformat_Append_DisplayWithAlign_Internal(length - 1, count - 1, text, string, fs, false);
 }
 
-size_t _sformat_HandleNonzeroFloat(const bool isNegative, const uint64_t significand, const int64_t exponent, const sformatState &fs, char *text)
+struct _sformat_SIPrefix
+{
+  char chars[3];
+  uint8_t length;
+};
+
+static constexpr int64_t _sformat_SIPrefixMinExponent = -24;
+
+static constexpr _sformat_SIPrefix _sformat_SIPrefixes[] =
+{
+  { "y", 1 }, { "z", 1 }, { "a", 1 }, { "f", 1 }, { "p", 1 }, { "n", 1 }, { "\xC2\xB5", 2 }, { "m", 1 },
+  { "", 0 },
+  { "k", 1 }, { "M", 1 }, { "G", 1 }, { "T", 1 }, { "P", 1 }, { "E", 1 }, { "Z", 1 }, { "Y", 1 },
+};
+
+static_assert(std::size(_sformat_SIPrefixes) == (-_sformat_SIPrefixMinExponent * 2) / 3 + 1, "Invalid SI prefix table.");
+
+size_t _sformat_HandleNonzeroFloat(const bool isNegative, const uint64_t significand, int64_t exponent, const sformatState &fs, char *text)
 {
   size_t signChars = 0;
   size_t numberBytes = 0;
@@ -4107,8 +6231,8 @@ size_t _sformat_HandleNonzeroFloat(const bool isNegative, const uint64_t signifi
   }
   }
 
-  char buffer[21];
-  char *pBuffer = &buffer[std::size(buffer) - 1];
+  char buffer[21 + 2]; // + 2 for trailing zeroes in engineering notation.
+  char *pBuffer = &buffer[std::size(buffer) - 1 - 2];
 
   // Serialize significand.
   {
@@ -4142,8 +6266,37 @@ size_t _sformat_HandleNonzeroFloat(const bool isNegative, const uint64_t signifi
   }
 
   bool scientificNotation = fs.scientificNotation;
+  size_t requestedFractionalDigits = fs.fractionalDigits;
+
+  if (fs.shortestFloatNotation)
+  {
+    // Display all digits (without trailing zeroes) and pick whichever notation is shorter (or fixed, if they're equally long).
+    while (numberBytes > 1 && pBuffer[numberBytes - 1] == '0')
+    {
+      numberBytes--;
+      exponent++;
+    }
+
+    const int64_t decimalSeparatorPosition = (int64_t)numberBytes + exponent;
+    size_t fixedBytes;
+
+    if (decimalSeparatorPosition <= 0)
+      fixedBytes = 1 + fs.decimalSeparatorLength + (size_t)-decimalSeparatorPosition + numberBytes;
+    else if ((size_t)decimalSeparatorPosition >= numberBytes)
+      fixedBytes = (size_t)decimalSeparatorPosition;
+    else
+      fixedBytes = numberBytes + fs.decimalSeparatorLength;
+
+    if (fs.groupDigits && decimalSeparatorPosition > 0)
+      fixedBytes += _sformat_GetDigitGroupingCharCount((size_t)decimalSeparatorPosition, fs) * fs.digitGroupingCharLength;
 
-  if (!scientificNotation && fs.adaptiveFloatScientificNotation)
+    const size_t absScientificExponent = (size_t)std::abs(decimalSeparatorPosition - 1);
+    const size_t scientificBytes = 1 + (numberBytes > 1) * (fs.decimalSeparatorLength + numberBytes - 1) + 2 + 1 + (absScientificExponent >= 10) + (absScientificExponent >= 100);
+
+    scientificNotation = scientificBytes < fixedBytes;
+    requestedFractionalDigits = scientificNotation ? numberBytes - 1 : (size_t)_max(0LL, (int64_t)numberBytes - decimalSeparatorPosition);
+  }
+  else if (!scientificNotation && fs.adaptiveFloatScientificNotation)
   {
     const int64_t approxExponent = (int64_t)numberBytes + exponent; // may not be accurate, because rounding might add another digit.
 
@@ -4152,12 +6305,18 @@ size_t _sformat_HandleNonzeroFloat(const bool isNegative, const uint64_t signifi
 
   if (!scientificNotation)
   {
-    return _sformat_Append_DecimalFloat(isNegative, signChar, signChars, numberBytes, pBuffer, exponent, fs, text);
+    return _sformat_Append_DecimalFloat(isNegative, signChar, signChars, numberBytes, pBuffer, exponent, requestedFractionalDigits, fs, text);
   }
   else
   {
-    int64_t maxDecimalDigits = fs.maxChars - signChars - 1 - 1 - 2;
-    const size_t absTmpExponent = std::abs(exponent + (int64_t)numberBytes - 1); // This may be inaccurate in case rounding introduces another digit.
+    // Engineering notation displays one to three integer digits, so that the exponent is a multiple of 3.
+    size_t integerDigits = 1;
+
+    if (fs.engineeringNotation && !fs.shortestFloatNotation)
+      integerDigits += (size_t)(((exponent + (int64_t)numberBytes - 1) % 3 + 3) % 3); // This may be inaccurate in case rounding introduces another digit.
+
+    int64_t maxDecimalDigits = fs.maxChars - signChars - integerDigits - 1 - 2;
+    const size_t absTmpExponent = std::abs(exponent + (int64_t)numberBytes - (int64_t)integerDigits); // This may be inaccurate in case rounding introduces another digit.
 
     if (absTmpExponent < 9) // In case rounding introduces another digit this is < 9, not <= 9
       maxDecimalDigits -= 1;
@@ -4166,10 +6325,11 @@ size_t _sformat_HandleNonzeroFloat(const bool isNegative, const uint64_t signifi
     else
       maxDecimalDigits -= 3; // the maximum double exponent is 308/-308.
 
-    const size_t fractionalDigits = _min(fs.fractionalDigits, (size_t)_max(maxDecimalDigits, 0LL));
+    const size_t fractionalDigits = _min(requestedFractionalDigits, (size_t)_max(maxDecimalDigits, 0LL));
+    const size_t keptDigits = integerDigits + fractionalDigits;
 
-    char *pRoundChar = pBuffer + fractionalDigits;
-    const bool round = numberBytes - 1 > fractionalDigits && pBuffer[fractionalDigits + 1] >= '5';
+    char *pRoundChar = pBuffer + keptDigits - 1;
+    const bool round = numberBytes > keptDigits && pBuffer[keptDigits] >= '5';
 
     if (round)
     {
@@ -4197,40 +6357,230 @@ size_t _sformat_HandleNonzeroFloat(const bool isNegative, const uint64_t signifi
 
     int64_t scientificExponent = exponent + numberBytes - 1;
 
+    if (fs.engineeringNotation && !fs.shortestFloatNotation)
+    {
+      integerDigits = 1 + (size_t)((scientificExponent % 3 + 3) % 3);
+      scientificExponent -= integerDigits - 1;
+
+      while (numberBytes < integerDigits)
+      {
+        pBuffer[numberBytes] = '0';
+        numberBytes++;
+      }
+    }
+
     char exponentBuffer[13];
     char *pExponentBuffer = &exponentBuffer[std::size(exponentBuffer) - 1];
     size_t exponentBytes = 0;
 
+    if (fs.siPrefixNotation && !fs.shortestFloatNotation && scientificExponent >= _sformat_SIPrefixMinExponent && scientificExponent <= -_sformat_SIPrefixMinExponent)
     {
-      size_t tmp = std::abs(scientificExponent);
+      const _sformat_SIPrefix &prefix = _sformat_SIPrefixes[(scientificExponent - _sformat_SIPrefixMinExponent) / 3];
 
-      while (tmp >= 10)
+      pExponentBuffer = exponentBuffer;
+      memcpy(pExponentBuffer, prefix.chars, prefix.length);
+      exponentBytes = prefix.length;
+    }
+    else
+    {
       {
-        *pExponentBuffer = (char)('0' + (tmp % 10));
-        pExponentBuffer--;
-        tmp /= 10;
-        exponentBytes++;
+        size_t tmp = std::abs(scientificExponent);
+
+        while (tmp >= 10)
+        {
+          *pExponentBuffer = (char)('0' + (tmp % 10));
+          pExponentBuffer--;
+          tmp /= 10;
+          exponentBytes++;
+        }
+
+        if (tmp != 0 || exponentBytes == 0)
+        {
+          *pExponentBuffer = (char)('0' + tmp);
+          pExponentBuffer--;
+          exponentBytes++;
+        }
+      }
+
+      // Add Sign & Expnent.
+      if (scientificExponent < 0)
+        *pExponentBuffer = '-';
+      else
+        *pExponentBuffer = '+';
+
+      pExponentBuffer--;
+      *pExponentBuffer = fs.exponentChar;
+      exponentBytes += 2;
+    }
+
+    return _sformat_Append_DecimalFloatScientific(isNegative, signChar, signChars, numberBytes, pBuffer, integerDigits, pExponentBuffer, exponentBytes, fractionalDigits, fs, text);
+  }
+}
+
+// `significandBits` must already be aligned to a multiple of four bits (`hexDigits` nibbles), without the implicit bit.
+size_t _sformat_Append_DecimalInsufficientSize(const bool negative, const size_t signChars, const char signChar, const sformatState &fs, char *text);
+
+size_t _sformat_AppendHexFloat(const bool isNegative, const uint64_t significandBits, const size_t hexDigits, const bool isNormal, const int64_t exponent, const sformatState &fs, char *text)
+{
+  size_t signChars = 0;
+  char signChar = '-';
+
+  switch (fs.signOption)
+  {
+  case FSO_Both:
+  {
+    signChars = 1;
+
+    if (!isNegative)
+      signChar = '+';
+
+    break;
+  }
+
+  case FSO_NegativeOrFill:
+  {
+    signChars = 1;
+
+    if (!isNegative)
+    {
+      if (fs.fillCharacterIsZero)
+        signChar = ' ';
+      else
+        signChar = fs.fillCharacter;
+    }
+
+    break;
+  }
+
+  case FSO_NegativeOnly:
+  {
+    if (isNegative)
+      signChars = 1;
+
+    break;
+  }
+  }
+
+  char buffer[sizeof("0x1.FFFFFFFFFFFFFp-1022")];
+  char *pBuffer = buffer;
+  const size_t lowerCaseCorrectionValue = (!fs.hexadecimalUpperCase) * ('a' - 'A') - 0xA;
+
+  size_t usefulHexDigits = hexDigits;
+  uint64_t tmp = significandBits;
+  size_t leadingDigit = (size_t)isNormal;
+
+  if (fs.adaptiveFractionalDigits)
+  {
+    while (usefulHexDigits > 0 && (tmp & 0xF) == 0)
+    {
+      tmp >>= 4;
+      usefulHexDigits--;
+    }
+  }
+
+  // If the number doesn't fit into `maxChars`, the lowest hex digits are rounded away (like decimal digits in scientific notation).
+  {
+    size_t exponentDigits = 1;
+
+    for (size_t absExponent = (size_t)std::abs(exponent); absExponent >= 10; absExponent /= 10)
+      exponentDigits++;
+
+    const size_t minBytes = signChars + sizeof("0x1p+") - 1 + exponentDigits;
+
+    if (fs.maxChars < minBytes)
+      return _sformat_Append_DecimalInsufficientSize(isNegative, signChars, signChar, fs, text);
+
+    const size_t maxHexDigits = fs.maxChars - minBytes > 1 ? fs.maxChars - minBytes - 1 : 0;
+
+    if (usefulHexDigits > maxHexDigits)
+    {
+      const size_t droppedBits = (usefulHexDigits - maxHexDigits) * 4;
+      const uint64_t roundUp = (tmp >> (droppedBits - 1)) & 1;
+
+      tmp = (tmp >> droppedBits) + roundUp;
+      usefulHexDigits = maxHexDigits;
+
+      // Rounding up may carry into the leading digit (e.g. `0x1.FFp+0` becomes `0x2p+0`).
+      if (tmp >> (usefulHexDigits * 4))
+      {
+        leadingDigit++;
+        tmp &= ((uint64_t)1 << (usefulHexDigits * 4)) - 1;
       }
 
-      if (tmp != 0 || exponentBytes == 0)
+      while (usefulHexDigits > 0 && (tmp & 0xF) == 0)
       {
-        *pExponentBuffer = (char)('0' + tmp);
-        pExponentBuffer--;
-        exponentBytes++;
+        tmp >>= 4;
+        usefulHexDigits--;
       }
     }
+  }
 
-    // Add Sign & Expnent.
-    if (scientificExponent < 0)
-      *pExponentBuffer = '-';
-    else
-      *pExponentBuffer = '+';
+  pBuffer[0] = '0';
+  pBuffer[1] = 'x';
+  pBuffer[2] = (char)('0' + leadingDigit);
+  pBuffer += 3;
+
+  if (usefulHexDigits > 0)
+  {
+    *pBuffer = '.';
+    pBuffer++;
+
+    for (size_t i = usefulHexDigits; i > 0; i--)
+    {
+      const size_t digit = (size_t)((tmp >> ((i - 1) * 4)) & 0xF);
+
+      *pBuffer = (char)(digit <= 9 ? ('0' + digit) : ('A' + digit + lowerCaseCorrectionValue));
+      pBuffer++;
+    }
+  }
+
+  *pBuffer = 'p';
+  pBuffer++;
+  *pBuffer = exponent < 0 ? '-' : '+';
+  pBuffer++;
+
+  // Serialize exponent.
+  {
+    char exponentBuffer[4];
+    char *pExponentBuffer = &exponentBuffer[std::size(exponentBuffer) - 1];
+    size_t exponentBytes = 0;
+    size_t absExponent = (size_t)std::abs(exponent);
+
+    while (absExponent >= 10)
+    {
+      *pExponentBuffer = (char)('0' + (absExponent % 10));
+      pExponentBuffer--;
+      absExponent /= 10;
+      exponentBytes++;
+    }
+
+    *pExponentBuffer = (char)('0' + absExponent);
+    exponentBytes++;
+
+    memcpy(pBuffer, pExponentBuffer, exponentBytes);
+    pBuffer += exponentBytes;
+  }
 
-    pExponentBuffer--;
-    *pExponentBuffer = fs.exponentChar;
-    exponentBytes += 2;
+  const size_t numberBytes = pBuffer - buffer;
+  const size_t totalBytes = signChars + numberBytes;
 
-    return _sformat_Append_DecimalFloatScientific(isNegative, signChar, signChars, numberBytes, pBuffer, 1, pExponentBuffer, exponentBytes, fractionalDigits, fs, text);
+  if (fs.minChars <= totalBytes && fs.maxChars >= totalBytes)
+  {
+    if (signChars)
+    {
+      *text = signChar;
+      text++;
+    }
+
+    memcpy(text, buffer, numberBytes);
+
+    return totalBytes;
+  }
+  else
+  {
+    _sformat_Append_DisplayWithAlignNoGroupingWithSign_Internal(totalBytes, signChars, signChar, numberBytes, text, buffer, fs);
+
+    return fs.minChars;
   }
 }
 
@@ -4245,6 +6595,16 @@ size_t _sformat_Append(const float_t value, const sformatState &fs, char *text)
 
   if (br.is_finite(exponent_bits))
   {
+    if (fs.hexFloat)
+    {
+      constexpr size_t significandBits = jkj::dragonbox::ieee754_binary32::significand_bits;
+      constexpr size_t hexDigits = (significandBits + 3) / 4;
+      const bool isNormal = exponent_bits != 0;
+      const int64_t exponent = br.is_nonzero() ? br.binary_exponent(exponent_bits) : 0;
+
+      return _sformat_AppendHexFloat(s.is_negative(), (uint64_t)br.extract_significand_bits() << (hexDigits * 4 - significandBits), hexDigits, isNormal, exponent, fs, text);
+    }
+
     if (br.is_nonzero())
     {
       auto result = jkj::dragonbox::to_decimal<Float, FloatTraits>(s, exponent_bits,
@@ -4252,7 +6612,7 @@ size_t _sformat_Append(const float_t value, const sformatState &fs, char *text)
         jkj::dragonbox::policy::trailing_zero::remove,
         jkj::dragonbox::policy::decimal_to_binary_rounding::nearest_to_even,
         jkj::dragonbox::policy::binary_to_decimal_rounding::to_even,
-        jkj::dragonbox::policy::cache::full);
+        _sformat_DragonboxCachePolicy);
 
       return _sformat_HandleNonzeroFloat(s.is_negative(), result.significand, result.exponent, fs, text);
     }
@@ -4278,9 +6638,9 @@ size_t _sformat_Append(const float_t value, const sformatState &fs, char *text)
         break;
       }
 
-      if (!fs.scientificNotation)
+      if (!fs.scientificNotation || fs.shortestFloatNotation)
       {
-        return _sformat_Append_DecimalFloat(false, signChar, signChars, 1, "0", 0, fs, text);
+        return _sformat_Append_DecimalFloat(false, signChar, signChars, 1, "0", 0, fs.fractionalDigits, fs, text);
       }
       else
       {
@@ -4291,7 +6651,7 @@ size_t _sformat_Append(const float_t value, const sformatState &fs, char *text)
         exponentBuffer[1] = '+';
         exponentBuffer[2] = '0';
 
-        return _sformat_Append_DecimalFloatScientific(false, signChar, signChars, 1, "0", 1, exponentBuffer, 3, fractionalDigits, fs, text);
+        return _sformat_Append_DecimalFloatScientific(false, signChar, signChars, 1, "0", 1, exponentBuffer, fs.siPrefixNotation ? 0 : 3, fractionalDigits, fs, text);
       }
     }
   }
@@ -4322,6 +6682,16 @@ size_t _sformat_Append(const double_t value, const sformatState &fs, char *text)
 
   if (br.is_finite(exponent_bits))
   {
+    if (fs.hexFloat)
+    {
+      constexpr size_t significandBits = jkj::dragonbox::ieee754_binary64::significand_bits;
+      constexpr size_t hexDigits = (significandBits + 3) / 4;
+      const bool isNormal = exponent_bits != 0;
+      const int64_t exponent = br.is_nonzero() ? br.binary_exponent(exponent_bits) : 0;
+
+      return _sformat_AppendHexFloat(s.is_negative(), (uint64_t)br.extract_significand_bits() << (hexDigits * 4 - significandBits), hexDigits, isNormal, exponent, fs, text);
+    }
+
     if (br.is_nonzero())
     {
       auto result = jkj::dragonbox::to_decimal<Float, FloatTraits>(s, exponent_bits,
@@ -4329,7 +6699,7 @@ size_t _sformat_Append(const double_t value, const sformatState &fs, char *text)
         jkj::dragonbox::policy::trailing_zero::ignore,
         jkj::dragonbox::policy::decimal_to_binary_rounding::nearest_to_even,
         jkj::dragonbox::policy::binary_to_decimal_rounding::to_even,
-        jkj::dragonbox::policy::cache::full);
+        _sformat_DragonboxCachePolicy);
 
       return _sformat_HandleNonzeroFloat(s.is_negative(), result.significand, result.exponent, fs, text);
     }
@@ -4355,9 +6725,9 @@ size_t _sformat_Append(const double_t value, const sformatState &fs, char *text)
         break;
       }
 
-      if (!fs.scientificNotation)
+      if (!fs.scientificNotation || fs.shortestFloatNotation)
       {
-        return _sformat_Append_DecimalFloat(false, signChar, signChars, 1, "0", 0, fs, text);
+        return _sformat_Append_DecimalFloat(false, signChar, signChars, 1, "0", 0, fs.fractionalDigits, fs, text);
       }
       else
       {
@@ -4368,7 +6738,7 @@ size_t _sformat_Append(const double_t value, const sformatState &fs, char *text)
         exponentBuffer[1] = '+';
         exponentBuffer[2] = '0';
 
-        return _sformat_Append_DecimalFloatScientific(false, signChar, signChars, 1, "0", 1, exponentBuffer, 3, fractionalDigits, fs, text);
+        return _sformat_Append_DecimalFloatScientific(false, signChar, signChars, 1, "0", 1, exponentBuffer, fs.siPrefixNotation ? 0 : 3, fractionalDigits, fs, text);
       }
     }
   }
@@ -4396,50 +6766,166 @@ size_t _sformat_AppendBool(const bool value, const sformatState &fs, char *text)
     return _sformat_AppendStringWithLength(fs.falseChars, fs.falseBytes, fs, text);
 }
 
-constexpr size_t _maxUtf16InUtf8Chars = 3;
+// Unpaired surrogates are replaced by U+FFFD.
+size_t _sformat_TranscodeToUtf8(const char16_t *string, const size_t length, char *text)
+{
+  char *originalTextPosition = text;
+  size_t i = 0;
 
-size_t _sformat_Append(const wchar_t value, const sformatState &fs, char *text)
+  while (i < length)
+  {
+#ifdef _SFORMAT_SSE2
+    // ASCII runs are narrowed 16 code units at a time.
+    {
+      const __m128i nonAsciiBits = _mm_set1_epi16((short)0xFF80);
+      const __m128i zero = _mm_setzero_si128();
+
+      for (; i + 16 <= length; i += 16, text += 16)
+      {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + i + 8));
+
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), nonAsciiBits), zero)) != 0xFFFF)
+          break;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(text), _mm_packus_epi16(a, b));
+      }
+    }
+#endif
+
+    const size_t blockEnd = _min(i + 16, length);
+
+    while (i < blockEnd)
+    {
+      uint32_t codePoint = string[i];
+      i++;
+
+      if (codePoint >= 0xD800 && codePoint < 0xE000)
+      {
+        if (codePoint < 0xDC00 && i < length && string[i] >= 0xDC00 && string[i] < 0xE000)
+        {
+          codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (string[i] - 0xDC00);
+          i++;
+        }
+        else
+        {
+          codePoint = 0xFFFD;
+        }
+      }
+
+      text += _sformat_EncodeUtf8(codePoint, text);
+    }
+  }
+
+  return text - originalTextPosition;
+}
+
+// Surrogates and values beyond U+10FFFF are replaced by U+FFFD.
+size_t _sformat_TranscodeToUtf8(const char32_t *string, const size_t length, char *text)
 {
-  if (value == 0)
-    return 0;
+  char *originalTextPosition = text;
+  size_t i = 0;
+
+  while (i < length)
+  {
+#ifdef _SFORMAT_SSE2
+    // ASCII runs are narrowed 16 code units at a time.
+    {
+      const __m128i nonAsciiBits = _mm_set1_epi32((int32_t)0xFFFFFF80);
+      const __m128i zero = _mm_setzero_si128();
 
-  char buffer[_maxUtf16InUtf8Chars + 1];
-  wchar_t wbuffer[2] = { value, 0 };
+      for (; i + 16 <= length; i += 16, text += 16)
+      {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + i + 4));
+        const __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + i + 8));
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(string + i + 12));
 
-  const size_t bytes = WideCharToMultiByte(CP_UTF8, 0, wbuffer, (int32_t)std::size(wbuffer), buffer, (int32_t)std::size(buffer), nullptr, false);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), nonAsciiBits), zero)) != 0xFFFF)
+          break;
 
-  if (bytes <= 1 || fs.maxChars < bytes - 1)
-    return 0;
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(text), _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+      }
+    }
+#endif
+
+    const size_t blockEnd = _min(i + 16, length);
+
+    for (; i < blockEnd; i++)
+    {
+      uint32_t codePoint = string[i];
+
+      if (codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint < 0xE000))
+        codePoint = 0xFFFD;
 
-  memcpy(text, buffer, bytes - 1);
+      text += _sformat_EncodeUtf8(codePoint, text);
+    }
+  }
 
-  return bytes - 1;
+  return text - originalTextPosition;
 }
 
-size_t _sformat_AppendWStringWithLength(const wchar_t *string, const size_t charCount, const sformatState &fs, char *text)
+template <typename T>
+size_t _sformat_AppendWideString(const T *string, const size_t length, const sformatState &fs, char *text)
 {
   if (string == nullptr)
     return 0;
 
-  const size_t wcharLength = charCount + 1;
-  char *buffer = nullptr;
-  const size_t bufferCapacity = (wcharLength - 1) * _maxUtf16InUtf8Chars + 1;
-  sformat_allocator *const pAllocator = &_default_sformat_allocator;
+  const size_t maxUtf8Bytes = length * _sformat_MaxUtf8BytesPerCodeUnit<T>;
+
+  if (fs.minChars == 0 && fs.maxChars >= maxUtf8Bytes && fs.stringEscape == FEO_None && fs.stringCase == FCO_None)
+    return _sformat_TranscodeToUtf8(string, length, text);
+
+  // Strings that may have to be padded, truncated, converted or escaped are transcoded behind the output (`_sformat_GetWideStringMaxBytes` reserves space for that) and appended from there.
+  char *buffer = text + _sformat_GetCaseConvertedStringMaxBytes(maxUtf8Bytes, fs);
+  const size_t bytes = _sformat_TranscodeToUtf8(string, length, buffer);
+
+  return _sformat_AppendCaseConvertedStringWithLength(buffer, bytes, fs, text);
+}
 
-  if (!pAllocator->alloc(reinterpret_cast<void **>(&buffer), bufferCapacity))
+template <typename T>
+size_t _sformat_AppendWideChar(const T value, const sformatState &fs, char *text)
+{
+  if (value == 0 || fs.maxChars == 0)
     return 0;
 
-  memset(buffer, 0, bufferCapacity);
+  return _sformat_TranscodeToUtf8(&value, 1, text);
+}
+
+size_t _sformat_Append(const wchar_t value, const sformatState &fs, char *text)
+{
+  if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+    return _sformat_AppendWideChar((char16_t)value, fs, text);
+  else
+    return _sformat_AppendWideChar((char32_t)value, fs, text);
+}
+
+size_t _sformat_Append(const char16_t value, const sformatState &fs, char *text)
+{
+  return _sformat_AppendWideChar(value, fs, text);
+}
 
-  const size_t bytes = WideCharToMultiByte(CP_UTF8, 0, string, (int32_t)wcharLength, buffer, (int32_t)bufferCapacity, nullptr, false);
+size_t _sformat_Append(const char32_t value, const sformatState &fs, char *text)
+{
+  return _sformat_AppendWideChar(value, fs, text);
+}
 
-  pAllocator->free(buffer);
-  buffer = nullptr;
+size_t _sformat_AppendWStringWithLength(const wchar_t *string, const size_t charCount, const sformatState &fs, char *text)
+{
+  if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+    return _sformat_AppendWideString(reinterpret_cast<const char16_t *>(string), charCount, fs, text);
+  else
+    return _sformat_AppendWideString(reinterpret_cast<const char32_t *>(string), charCount, fs, text);
+}
 
-  if (bytes <= 1)
-    return 0;
+size_t _sformat_AppendWStringWithLength(const char16_t *string, const size_t charCount, const sformatState &fs, char *text)
+{
+  return _sformat_AppendWideString(string, charCount, fs, text);
+}
 
-  return _sformat_AppendStringWithLength(buffer, bytes - 1, fs, text);
+size_t _sformat_AppendWStringWithLength(const char32_t *string, const size_t charCount, const sformatState &fs, char *text)
+{
+  return _sformat_AppendWideString(string, charCount, fs, text);
 }
 
 //////////////////////////////////////////////////////////////////////////
@@ -4589,7 +7075,8 @@ size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, const
 {
   char *originalTextPosition = text;
 
-  if (totalChars <= fs.maxChars)
+  // Invalid UTF-8 strings (continuation bytes without a lead byte) may have more than 4 bytes per counted char, so they aren't bounded by `maxChars` & have to be truncated anyways.
+  if (totalChars <= fs.maxChars && (isNumber || fs.stringDisplayWidth || (totalBytes + 3) / 4 <= fs.maxChars))
   {
     const sformatAlign align = isNumber ? fs.numberAlign : fs.stringAlign;
 
@@ -4700,22 +7187,45 @@ size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, const
       if (useEllipsis)
         charsRemaining -= fs.stringOverflowEllipsisCount;
 
-      while (charsRemaining > 0 && bytesRemaining > 0)
+      const char *bufferStart = buffer;
+      size_t padding = 0;
+
+      if (fs.stringDisplayWidth)
       {
-        const size_t charSize = utf8_charsize(buffer);
+        size_t columns;
+        const size_t prefixBytes = _sformat_GetDisplayWidthPrefixLength(buffer, bytesRemaining, charsRemaining, &columns);
 
-        *text = *buffer;
+        memcpy(text, buffer, prefixBytes);
+        text += prefixBytes;
+        buffer += prefixBytes;
 
-        if (charSize >= 2)
-          text[1] = buffer[1];
+        // A wide character that didn't fit anymore is replaced by a space.
+        padding = charsRemaining - columns;
+        charsRemaining = 0;
+      }
+      else
+      {
+        // Copy the ASCII prefix in one go, only multi byte characters need to be walked one by one.
+        const size_t asciiBytes = _sformat_GetAsciiPrefixLength(buffer, _min(charsRemaining, bytesRemaining));
+
+        memcpy(text, buffer, asciiBytes);
 
-        if (charSize >= 3)
-          text[2] = buffer[2];
+        text += asciiBytes;
+        buffer += asciiBytes;
+        bytesRemaining -= asciiBytes;
+        charsRemaining -= asciiBytes;
+      }
+
+      while (charsRemaining > 0 && bytesRemaining > 0)
+      {
+        // Advance to the next non-continuation byte (like `_sformat_GetStringCount` counts them), but by no more than 4 bytes, so invalid UTF-8 can't make the truncated string exceed `sformat_GetMaxBytes`.
+        const size_t maxCharSize = _min(bytesRemaining, (size_t)4);
+        size_t charSize = 1;
 
-        if (charSize == 4)
-          text[3] = buffer[3];
+        while (charSize < maxCharSize && ((uint8_t)buffer[charSize] & 0xC0) == 0x80)
+          charSize++;
 
-        assert(charSize <= 4 && "Invalid char size.");
+        memcpy(text, buffer, charSize);
 
         text += charSize;
         buffer += charSize;
@@ -4723,6 +7233,27 @@ size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, const
         charsRemaining--;
       }
 
+
+      if (fs.stringGraphemeClusters)
+      {
+        const size_t prefixBytes = buffer - bufferStart;
+        const size_t boundary = _sformat_GetGraphemeClusterBoundary(bufferStart, totalBytes, prefixBytes);
+
+        // The incomplete grapheme cluster is replaced by spaces.
+        if (fs.stringDisplayWidth)
+          padding += _sformat_GetStringDisplayWidth(bufferStart + boundary, prefixBytes - boundary);
+        else
+          padding += _sformat_GetStringCount(bufferStart + boundary, prefixBytes - boundary);
+
+        text -= prefixBytes - boundary;
+      }
+
+      for (; padding > 0; padding--)
+      {
+        *text = ' ';
+        text++;
+      }
+
       if (useEllipsis)
       {
         memcpy(text, fs.stringOverflowEllipsisChars, fs.stringOverflowEllipsisLength);
@@ -4751,10 +7282,10 @@ size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, char *
       memcpy(text, buffer, totalBytes);
       text += totalBytes;
 
-      if (fs.minChars * 4 > totalBytes)
+      if (fs.minChars * 4 > totalBytes || fs.stringDisplayWidth)
       {
         size_t spacing = 0;
-        const size_t totalChars = _sformat_GetStringCount(buffer, totalBytes);
+        const size_t totalChars = _sformat_GetStringColumns(buffer, totalBytes, fs);
 
         if (totalChars)
         {
@@ -4780,7 +7311,7 @@ size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, char *
 
     case FA_Right:
     {
-      const size_t totalChars = _sformat_GetStringCount(buffer, totalBytes);
+      const size_t totalChars = _sformat_GetStringColumns(buffer, totalBytes, fs);
 
       if (totalChars)
       {
@@ -4810,7 +7341,7 @@ size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, char *
         fillCharacter = ' ';
       }
 
-      const size_t totalChars = _sformat_GetStringCount(buffer, totalBytes);
+      const size_t totalChars = _sformat_GetStringColumns(buffer, totalBytes, fs);
 
       if (totalChars < fs.minChars)
       {
@@ -4841,7 +7372,7 @@ size_t _sformat_Append_DisplayWithAlign_Internal(const size_t totalBytes, char *
   }
   else
   {
-    const size_t totalChars = _sformat_GetStringCount(buffer, totalBytes);
+    const size_t totalChars = _sformat_GetStringColumns(buffer, totalBytes, fs);
 
     return _sformat_Append_DisplayWithAlign_Internal(totalBytes, totalChars, text, buffer, fs, false);
   }
@@ -4938,7 +7469,7 @@ size_t _sformat_Append_DecimalInsufficientSize(const bool negative, const size_t
 }
 
 // Side effect: The buffer should provide room for one more digit in front of the actual first digit (in case rounding introduces another digit).
-size_t _sformat_Append_DecimalFloat(const bool negative, const char signChar, const size_t signChars, const size_t digits, char *inputBuffer, const int64_t exponent, const sformatState &fs, char *text)
+size_t _sformat_Append_DecimalFloat(const bool negative, const char signChar, const size_t signChars, const size_t digits, char *inputBuffer, const int64_t exponent, const size_t fractionalDigits, const sformatState &fs, char *text)
 {
   size_t inputDigits = digits;
   int64_t inputExponent = exponent;
@@ -4950,7 +7481,7 @@ size_t _sformat_Append_DecimalFloat(const bool negative, const char signChar, co
     const size_t tmpSignificantDigits = (size_t)_max(0LL, tmpDecimalSeparatorPosition);
     const size_t tmpNecessaryChars = signChars + _max(1ULL, tmpSignificantDigits + fs.groupDigits * (_sformat_GetDigitGroupingCharCount(tmpSignificantDigits, fs) * fs.digitGroupingCharLength));
     const size_t tmpExistentFractionalDigits = (size_t)_max(0LL, (int64_t)inputDigits - tmpDecimalSeparatorPosition);
-    size_t tmpMaxFractionalChars = _min(fs.maxChars - tmpNecessaryChars, fs.fractionalDigits + 1);
+    size_t tmpMaxFractionalChars = _min(fs.maxChars - tmpNecessaryChars, fractionalDigits + 1);
 
     if (fs.fillCharacterIsZero && fs.numberAlign == FA_Left && fs.minChars > tmpNecessaryChars)
       tmpMaxFractionalChars = _max(fs.minChars - tmpNecessaryChars, tmpMaxFractionalChars);
@@ -4959,9 +7490,10 @@ size_t _sformat_Append_DecimalFloat(const bool negative, const char signChar, co
 
     if (tmpExistentFractionalDigits > tmpMaxFractionalDigitChars)
     {
-      char *roundChar = buffer + tmpMaxFractionalDigitChars + tmpDecimalSeparatorPosition;
+      const int64_t roundIndex = (int64_t)tmpMaxFractionalDigitChars + tmpDecimalSeparatorPosition;
+      char *roundChar = buffer + roundIndex;
 
-      if (*roundChar >= '5')
+      if (roundIndex >= 0 && *roundChar >= '5') // if the first dropped digit is in front of the first digit, it's an implicit zero.
       {
         roundChar--;
 
@@ -4997,7 +7529,7 @@ size_t _sformat_Append_DecimalFloat(const bool negative, const char signChar, co
   const size_t significantChars = _max(1ULL, significantDigits + fs.groupDigits * (_sformat_GetDigitGroupingCharCount(significantDigits, fs) * fs.digitGroupingCharLength));
   const size_t necessaryChars = significantChars + signChars;
 
-  size_t maxFractionalChars = (size_t)_min(_max(0LL, (int64_t)fs.maxChars - (int64_t)necessaryChars), (int64_t)fs.fractionalDigits + 1);
+  size_t maxFractionalChars = (size_t)_min(_max(0LL, (int64_t)fs.maxChars - (int64_t)necessaryChars), (int64_t)fractionalDigits + 1);
 
   if (fs.fillCharacterIsZero && fs.numberAlign == FA_Left && fs.minChars > necessaryChars)
     maxFractionalChars = _max(fs.minChars - necessaryChars, maxFractionalChars);
@@ -5313,7 +7845,23 @@ size_t _sformat_Append_DecimalFloatScientific(const bool negative, const char si
   size_t usefulDigits = digits;
   size_t usefulFractionalDigits = fractionalDigits;
 
-  if (fs.adaptiveFractionalDigits)
+  // Engineering notation may have up to three integer digits & Shortest must display every digit, so they count all useful fractional digits. `Exp` keeps its previous output.
+  if (fs.adaptiveFractionalDigits && (fs.engineeringNotation || fs.shortestFloatNotation))
+  {
+    size_t usefulFractionalDigitCount = 0;
+
+    for (size_t i = 0; i < fractionalDigits; i++)
+    {
+      if (decimalSeparatorPosition + i >= digits)
+        break;
+      else if (buffer[decimalSeparatorPosition + i] != '0')
+        usefulFractionalDigitCount = i + 1;
+    }
+
+    usefulDigits = usefulFractionalDigitCount + decimalSeparatorPosition;
+    usefulFractionalDigits = usefulFractionalDigitCount;
+  }
+  else if (fs.adaptiveFractionalDigits)
   {
     size_t lastUsefulDigit = 0;
 
@@ -5321,7 +7869,7 @@ size_t _sformat_Append_DecimalFloatScientific(const bool negative, const char si
     {
       if (decimalSeparatorPosition + i > digits)
         break;
-      else if (buffer[decimalSeparatorPosition + i] != '0')
+      else if (decimalSeparatorPosition + i == digits || buffer[decimalSeparatorPosition + i] != '0') // `buffer` ends after `digits`, all of them are displayed if there are no more than `fractionalDigits`.
         lastUsefulDigit = i;
     }
 
@@ -5329,7 +7877,14 @@ size_t _sformat_Append_DecimalFloatScientific(const bool negative, const char si
     usefulFractionalDigits = usefulDigits - decimalSeparatorPosition;
   }
 
-  const size_t totalChars = signChars + decimalSeparatorPosition + (usefulFractionalDigits > 0 ? (fs.decimalSeparatorLength + usefulFractionalDigits) : 0) + exponentLength;
+  // SI prefixes may take up multiple bytes (µ), but are only displayed as one char.
+  size_t exponentChars = exponentLength;
+
+  for (size_t i = 0; i < exponentLength; i++)
+    if (((uint8_t)exponentBuffer[i] & 0xC0) == 0x80)
+      exponentChars--;
+
+  const size_t totalChars = signChars + decimalSeparatorPosition + (usefulFractionalDigits > 0 ? (fs.decimalSeparatorLength + usefulFractionalDigits) : 0) + exponentChars;
 
   assert(decimalSeparatorPosition <= usefulDigits && "Unexpected decimal separator position.");
 
@@ -5519,10 +8074,12 @@ size_t _sformat_Append_DecimalFloatScientific(const bool negative, const char si
     }
   }
 
+  const size_t multiByteExponentBytes = exponentLength - exponentChars;
+
   if (fitsExact)
-    return totalChars;
+    return totalChars + multiByteExponentBytes;
   else
-    return _max(fs.minChars, totalChars);
+    return _max(fs.minChars, totalChars) + multiByteExponentBytes;
 }
 
 size_t _sformat_Append_Decimal(const bool negative, const char signChar, const size_t signChars, const size_t _digits, const char *buffer, const sformatState &fs, char *text)
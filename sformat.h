@@ -2,10 +2,16 @@
 #define sformat_h__
 
 #include <stdint.h>
+#include <stdio.h>
 #include <type_traits>
 #include <string>
+#include <string_view>
 #include <assert.h>
 
+#ifndef _WIN32
+#include <sys/uio.h>
+#endif
+
 template <typename T, typename U>
 constexpr inline auto _max(const T &a, const U &b) -> decltype(a > b ? a : b)
 {
@@ -89,6 +95,16 @@ struct _isFloatFormattable_t
   static constexpr bool value = std::is_floating_point<T>::value;
 };
 
+template <typename T>
+struct _isWideChar_t
+{
+  static constexpr bool value = std::is_same<T, wchar_t>::value || std::is_same<T, char16_t>::value || std::is_same<T, char32_t>::value;
+};
+
+// A UTF-16 code unit takes up to 3 bytes in UTF-8 (surrogate pairs take 4 for both code units), a UTF-32 one up to 4.
+template <typename T>
+constexpr size_t _sformat_MaxUtf8BytesPerCodeUnit = sizeof(T) == sizeof(char16_t) ? 3 : 4;
+
 template <typename T>
 struct _isIntegerFormattable_t
 {
@@ -166,10 +182,100 @@ struct _isFormattable_t<wchar_t[count]>
   static constexpr bool value = true;
 };
 
+template <>
+struct _isFormattable_t<const char16_t *>
+{
+  static constexpr bool value = true;
+};
+
+template <>
+struct _isFormattable_t<const char32_t *>
+{
+  static constexpr bool value = true;
+};
+
+template <size_t count>
+struct _isFormattable_t<char16_t[count]>
+{
+  static constexpr bool value = true;
+};
+
+template <size_t count>
+struct _isFormattable_t<char32_t[count]>
+{
+  static constexpr bool value = true;
+};
+
+// String literal with its length & code point count calculated at compile time (see `FL`).
+struct sformatLiteral
+{
+  const char *string;
+  size_t length; // in bytes, up to the first null terminator.
+  size_t count; // in code points.
+
+  template <size_t TCount>
+  constexpr sformatLiteral(const char(&value)[TCount]) : string(value), length(0), count(0)
+  {
+    while (length < TCount && value[length] != '\0')
+    {
+      count += ((uint8_t)value[length] & 0xC0) != 0x80;
+      length++;
+    }
+  }
+};
+
+template <>
+struct _isFormattable_t<sformatLiteral>
+{
+  static constexpr bool value = true;
+};
+
+template <typename T>
+struct _isStdString_t
+{
+  static constexpr bool value = std::is_same<T, std::string>::value || std::is_same<T, std::string_view>::value
+#ifdef __cpp_lib_char8_t
+    || std::is_same<T, std::u8string>::value || std::is_same<T, std::u8string_view>::value
+#endif
+    ;
+};
+
+template <typename T>
+struct _isStdWideString_t
+{
+  static constexpr bool value = std::is_same<T, std::wstring>::value || std::is_same<T, std::wstring_view>::value || std::is_same<T, std::u16string>::value || std::is_same<T, std::u16string_view>::value || std::is_same<T, std::u32string>::value || std::is_same<T, std::u32string_view>::value;
+};
+
+template <>
+struct _isFormattable_t<std::string>
+{
+  static constexpr bool value = true;
+};
+
+template <>
+struct _isFormattable_t<std::string_view>
+{
+  static constexpr bool value = true;
+};
+
+#ifdef __cpp_lib_char8_t
+template <>
+struct _isFormattable_t<std::u8string>
+{
+  static constexpr bool value = true;
+};
+
+template <>
+struct _isFormattable_t<std::u8string_view>
+{
+  static constexpr bool value = true;
+};
+#endif
+
 template <typename T, size_t count>
 struct _isListFormattable_t<T[count]>
 {
-  static constexpr bool value = !std::is_same<T, char>::value && !std::is_same<T, wchar_t>::value && _isFormattable_t<T>::value;
+  static constexpr bool value = !std::is_same<T, char>::value && !_isWideChar_t<T>::value && _isFormattable_t<T>::value;
   typedef T value_type;
 };
 
@@ -238,6 +344,21 @@ enum sformatDigitGroupingOption
   FDGO_Indian // For the Indian numbering system. (12,34,56,789)
 };
 
+enum sformatEscapeOption
+{
+  FEO_None,
+  FEO_Json, // `"`, `\` and control characters, as required in JSON strings. (other control characters become 6 byte unicode escapes)
+  FEO_C, // `"`, `\` and control characters, as required in C string literals. (other control characters become 3 digit octal escapes)
+  FEO_Control // only control characters, so strings can't mess with terminals or line based logs. (other control characters become 2 digit hex escapes)
+};
+
+enum sformatCaseOption
+{
+  FCO_None,
+  FCO_Upper, // ASCII, Latin, Greek & Cyrillic letters are converted to upper case.
+  FCO_Lower // ASCII, Latin, Greek & Cyrillic letters are converted to lower case.
+};
+
 // For Hexadecimal & Binary Values, Strings.
 enum sformatOverflowBehaviour
 {
@@ -254,6 +375,14 @@ struct sformat_allocator
 
 extern sformat_allocator _default_sformat_allocator;
 
+struct sformat_sink
+{
+  char *chunk; // formatted text is collected here & passed to `flush` whenever the next argument might not fit.
+  size_t capacity;
+  bool (*flush)(void *pUserData, const char *text, const size_t length); // must not use the thread local buffer (`sformat`, `sformat_view`, ...). returns false to abort.
+  void *pUserData;
+};
+
 struct sformatState
 {
   sformat_allocator *pAllocator = &_default_sformat_allocator;
@@ -261,6 +390,22 @@ struct sformatState
   size_t textCapacity = 0;
   size_t textPosition = 0;
   bool inFormatStatement = false;
+  size_t textShrinkCallCount = 1024; // the thread local buffer is shrunk after this many consecutive calls used less than a quarter of it (0 to never shrink it).
+  size_t textShrinkMinCapacity = 64 * 1024; // the thread local buffer is never shrunk below this capacity.
+  size_t textGrowthPercent = 0; // if not 0, the thread local buffer grows to at least this percentage of its previous capacity (e.g. 150), otherwise by twice the number of missing bytes.
+  size_t textCapacityAlignment = 1024; // the capacity of the thread local buffer is rounded up to a multiple of this (e.g. `sformat_GetPageSize()`).
+  int bufferedPrintFileDescriptor = 1; // `sformat_buffered_print` & `sformat_flush` write to this file descriptor (stdout by default).
+  size_t bufferedPrintFlushBytes = 64 * 1024; // buffered output is written once the next message might not fit into this many bytes.
+  size_t bufferedPrintMaxAgeMs = 100; // buffered output is written by the first `sformat_buffered_print` at least this many milliseconds after it was buffered (0 to only write it once it's full). the age is only checked by the next `sformat_buffered_print`, there's no timer: call `sformat_flush` before a thread goes idle or shuts down. it's also written by `sformat_flush` & when the thread exits.
+  char *printBufferStart = nullptr;
+  size_t printBufferCapacity = 0;
+  size_t printBufferPosition = 0;
+  uint64_t printBufferStartTimeMs = 0; // 0 if nothing is buffered.
+  size_t textHugePageMinCapacity = 0; // thread local buffers of at least this many bytes are rounded up to & advised to use huge pages (if supported by the OS). 0 to disable.
+  size_t textUnderusedCalls = 0;
+  size_t textUnderusedMaxPosition = 0;
+  bool optimisticFormatting = true; // if the buffer has at least `optimisticFormattingMinCapacity` bytes, arguments are only sized one by one while formatting (restarting with all arguments sized up front if one might not fit).
+  size_t optimisticFormattingMinCapacity = 1024;
   char fillCharacter = ' ';
   bool fillCharacterIsZero = false;
   size_t decimalSeparatorLength = 1;
@@ -290,6 +435,7 @@ struct sformatState
   size_t minChars = 0;
   size_t maxChars = INT64_MAX; // yes, not uint64_t max.
   size_t fractionalDigits = 5;
+  size_t decimalScale = 0; // decimal integers are displayed as `value / 10^decimalScale` (without converting to floating point).
   sformatSignOption signOption = FSO_NegativeOnly;
   bool alignSign = true;
   sformatBaseOption integerBaseOption = FBO_Decimal;
@@ -300,10 +446,18 @@ struct sformatState
   size_t stringOverflowEllipsisLength = 3;
   size_t stringOverflowEllipsisCount = 3;
   char stringOverflowEllipsisChars[8] = { '.', '.', '.', ' ', '\0' };
+  bool stringDisplayWidth = false; // strings are measured in terminal columns (wide east asian characters & emoji take two, combining marks none) instead of code points.
+  bool stringGraphemeClusters = false; // strings are only truncated at extended grapheme cluster boundaries, so combining marks, emoji sequences, flags etc. are never cut apart.
+  sformatEscapeOption stringEscape = FEO_None; // padding & truncation apply to the escaped string.
+  bool stringValidateUtf8 = false; // invalid UTF-8 sequences are replaced by U+FFFD (before escaping). non-ASCII text is only validated 32 bytes at a time in AVX2 builds: the lookup tables need `pshufb`, which SSE2 doesn't have, so SSE2 builds skip ASCII blocks & validate the rest code point by code point.
+  sformatCaseOption stringCase = FCO_None; // applied before escaping, never changes the number of code points.
   sformatOverflowBehaviour numberOverflow = FOB_AlignRight;
   size_t listMapMaxLength = 25;
   size_t listMapContinuationLength = 3; // doesn't include a null terminator.
   char listMapContinuation[5] = { '.', '.', '.', ' ', '\0' };
+  size_t ioVectorMinReferenceBytes = 512; // strings with at least this many bytes are referenced by `sformat_iovec` instead of being copied (unless they have to be padded, truncated, escaped, validated or case converted).
+  size_t truncationMarkerLength = 0; // output that `sformat_to` had to truncate ends with `truncationMarkerChars` (if it fits).
+  char truncationMarkerChars[16] = { '\0' };
   size_t infinityCount = 8;
   size_t infinityBytes = 8;
   char infinityChars[32] = "Infinity";
@@ -315,6 +469,10 @@ struct sformatState
   char nanChars[32] = "NaN";
   char exponentChar = 'e';
   bool scientificNotation = false;
+  bool engineeringNotation = false; // scientific notation with exponents that are a multiple of 3.
+  bool siPrefixNotation = false; // engineering notation with SI prefixes (from 'y' to 'Y') instead of exponents.
+  bool shortestFloatNotation = false; // all digits required to round-trip in whichever of fixed or scientific notation is shorter. takes precedence over all other notations except `hexFloat` and ignores `fractionalDigits`.
+  bool hexFloat = false; // exact binary significand & exponent (like `%a`), always uses '.' as decimal separator to remain parseable by `strtod`.
   size_t trueCount = 4;
   size_t trueBytes = 4;
   char trueChars[32] = "true";
@@ -338,6 +496,12 @@ struct sformatState
     textCapacity = 0;
     textPosition = 0;
     inFormatStatement = false;
+    textUnderusedCalls = 0;
+    textUnderusedMaxPosition = 0;
+    printBufferStart = nullptr;
+    printBufferCapacity = 0;
+    printBufferPosition = 0;
+    printBufferStartTimeMs = 0;
     pAllocator = &_default_sformat_allocator;
   }
 
@@ -348,6 +512,12 @@ struct sformatState
     char *previousTextStart = textStart;
     size_t previousTextCapacity = textCapacity;
     size_t previousTextPosition = textPosition;
+    size_t previousTextUnderusedCalls = textUnderusedCalls;
+    size_t previousTextUnderusedMaxPosition = textUnderusedMaxPosition;
+    char *previousPrintBufferStart = printBufferStart;
+    size_t previousPrintBufferCapacity = printBufferCapacity;
+    size_t previousPrintBufferPosition = printBufferPosition;
+    uint64_t previousPrintBufferStartTimeMs = printBufferStartTimeMs;
 
     new (this) sformatState(copy);
 
@@ -356,6 +526,12 @@ struct sformatState
     textStart = previousTextStart;
     textCapacity = previousTextCapacity;
     textPosition = previousTextPosition;
+    textUnderusedCalls = previousTextUnderusedCalls;
+    textUnderusedMaxPosition = previousTextUnderusedMaxPosition;
+    printBufferStart = previousPrintBufferStart;
+    printBufferCapacity = previousPrintBufferCapacity;
+    printBufferPosition = previousPrintBufferPosition;
+    printBufferStartTimeMs = previousPrintBufferStartTimeMs;
   }
 };
 
@@ -363,6 +539,38 @@ sformatState &sformat_GetState();
 sformatState &sformat_GetGlobalState();
 void sformatState_ResetCulture();
 
+// Grows the thread local buffer of the calling thread to at least `capacity` bytes (e.g. at thread start, to avoid growing it while formatting) & doesn't shrink it below that anymore. Returns false if the buffer is currently in use or couldn't be allocated.
+bool sformat_Reserve(const size_t capacity);
+
+size_t sformat_GetPageSize();
+
+// Frees the thread local buffer of the calling thread (it's allocated again when needed). Invalidates all results of `sformat`, `sformat_view`, etc. on this thread. Returns false if the buffer is currently in use. The buffer is also freed when the thread exits.
+bool sformat_ReleaseThreadBuffer();
+
+inline size_t _sformat_GetDigitGroupingCharCount(const size_t numberChars, const sformatState &fs)
+{
+  if (numberChars == 0)
+    return 0;
+
+  switch (fs.digitGroupingOption)
+  {
+  default:
+  case FDGO_Thousand:
+    return (numberChars - 1) / 3;
+
+  case FDGO_TenThousand:
+    return (numberChars - 1) / 4;
+
+  case FDGO_Indian:
+    size_t groupingChars = (size_t)!!((numberChars - 1) / 3);
+
+    if (groupingChars)
+      groupingChars += (numberChars - 4) / 2;
+
+    return groupingChars;
+  }
+}
+
 #pragma warning (push)
 #pragma warning (disable: 4702)
 
@@ -395,6 +603,9 @@ inline size_t sformat_GetMaxBytes(const T &value, const sformatState &fs)
     else
       numberChars = 19;
 
+      if (fs.decimalScale != 0)
+        return signChars + _clamp(numberChars + fs.groupDigits * _sformat_GetDigitGroupingCharCount(numberChars, fs) * fs.digitGroupingCharLength + fs.decimalSeparatorLength + fs.fractionalDigits, fs.minChars, fs.maxChars);
+
       if (fs.groupDigits)
       {
         size_t groupingChars;
@@ -455,30 +666,6 @@ inline size_t _sformat_Append(const T &value, const sformatState &fs, char *text
   return _sformat_Append((typename _enumEquivalentIntegerType<T>::type)value, fs, text);
 }
 
-inline size_t _sformat_GetDigitGroupingCharCount(const size_t numberChars, const sformatState &fs)
-{
-  if (numberChars == 0)
-    return 0;
-
-  switch (fs.digitGroupingOption)
-  {
-  default:
-  case FDGO_Thousand:
-    return (numberChars - 1) / 3;
-
-  case FDGO_TenThousand:
-    return (numberChars - 1) / 4;
-
-  case FDGO_Indian:
-    size_t groupingChars = (size_t)!!((numberChars - 1) / 3);
-
-    if (groupingChars)
-      groupingChars += (numberChars - 4) / 2;
-
-    return groupingChars;
-  }
-}
-
 template <typename T, typename std::enable_if<std::is_integral<T>::value &&std::is_unsigned<T>::value && !std::is_same<bool, T>::value>::type * = nullptr>
 inline size_t sformat_GetMaxBytes(const T &value, const sformatState &fs)
 {
@@ -507,6 +694,9 @@ inline size_t sformat_GetMaxBytes(const T &value, const sformatState &fs)
     else
       numberChars = 20;
 
+      if (fs.decimalScale != 0)
+        return signChars + _clamp(numberChars + fs.groupDigits * _sformat_GetDigitGroupingCharCount(numberChars, fs) * fs.digitGroupingCharLength + fs.decimalSeparatorLength + fs.fractionalDigits, fs.minChars, fs.maxChars);
+
       if (fs.groupDigits)
         return signChars + _clamp(numberChars + _sformat_GetDigitGroupingCharCount(numberChars, fs) * fs.digitGroupingCharLength, fs.minChars, fs.maxChars);
       else
@@ -554,17 +744,134 @@ inline size_t sformat_GetCount(const char &value, const sformatState &)
 
 inline size_t sformat_GetMaxBytes(const wchar_t &, const sformatState &)
 {
-  return 3; // i.e. 0x2026 will become 0xE2 0x80 0xA6 in UTF-8
+  return _sformat_MaxUtf8BytesPerCodeUnit<wchar_t>; // i.e. 0x2026 will become 0xE2 0x80 0xA6 in UTF-8
+}
+
+inline size_t sformat_GetMaxBytes(const char16_t &, const sformatState &)
+{
+  return _sformat_MaxUtf8BytesPerCodeUnit<char16_t>;
+}
+
+inline size_t sformat_GetMaxBytes(const char32_t &, const sformatState &)
+{
+  return _sformat_MaxUtf8BytesPerCodeUnit<char32_t>;
 }
 
 size_t _sformat_GetStringCount(const char *value, const size_t length);
+size_t _sformat_GetStringDisplayWidth(const char *value, const size_t length);
+
+inline size_t _sformat_GetStringColumns(const char *value, const size_t length, const sformatState &fs)
+{
+  if (fs.stringDisplayWidth)
+    return _sformat_GetStringDisplayWidth(value, strnlen(value, length));
+  else
+    return _sformat_GetStringCount(value, length);
+}
+
+size_t _sformat_GetStringEscapeOverhead(const char *value, const size_t length, const sformatEscapeOption escape);
+
+inline size_t _sformat_GetEscapedStringColumns(const char *value, const size_t length, const sformatState &fs)
+{
+  // Escape sequences only consist of ASCII characters.
+  if (fs.stringEscape != FEO_None)
+    return _sformat_GetStringColumns(value, length, fs) + _sformat_GetStringEscapeOverhead(value, strnlen(value, length), fs.stringEscape);
+  else
+    return _sformat_GetStringColumns(value, length, fs);
+}
+
+size_t _sformat_GetRepairedStringColumns(const char *value, const size_t length, const sformatState &fs);
+
+inline size_t _sformat_GetFormattedStringColumns(const char *value, const size_t length, const sformatState &fs)
+{
+  if (fs.stringValidateUtf8)
+    return _sformat_GetRepairedStringColumns(value, strnlen(value, length), fs);
+  else
+    return _sformat_GetEscapedStringColumns(value, length, fs);
+}
+
+inline size_t _sformat_GetAlignedStringMaxBytes(const size_t length, const sformatState &fs)
+{
+  // Zero width code points don't count towards `maxChars`, so truncated strings aren't bounded by it.
+  if (fs.stringDisplayWidth)
+    return length + fs.minChars + fs.stringOverflowEllipsisLength + 1;
+  else
+    return _clamp(length, fs.minChars * 4, fs.maxChars * 4);
+}
+
+constexpr size_t _sformat_MaxEscapedBytesPerByte(const sformatEscapeOption escape)
+{
+  return escape == FEO_Json ? sizeof("\\u001F") - 1 : (escape == FEO_None ? 1 : sizeof("\\037") - 1);
+}
+
+inline size_t _sformat_GetEscapedStringMaxBytes(const size_t length, const sformatState &fs)
+{
+  if (fs.stringEscape == FEO_None)
+    return _sformat_GetAlignedStringMaxBytes(length, fs);
+
+  const size_t maxEscapedBytes = length * _sformat_MaxEscapedBytesPerByte(fs.stringEscape);
+
+  // Strings that may have to be padded or truncated are escaped behind the output first.
+  if (fs.minChars == 0 && fs.maxChars >= maxEscapedBytes)
+    return maxEscapedBytes;
+  else
+    return _sformat_GetAlignedStringMaxBytes(maxEscapedBytes, fs) + maxEscapedBytes;
+}
+
+inline size_t _sformat_GetCaseConvertedStringMaxBytes(const size_t length, const sformatState &fs)
+{
+  if (fs.stringCase == FCO_None)
+    return _sformat_GetEscapedStringMaxBytes(length, fs);
+
+  // Case conversion never increases the number of bytes. Strings that may have to be padded, truncated or escaped are converted behind the output first.
+  if (fs.minChars == 0 && fs.maxChars >= length && fs.stringEscape == FEO_None)
+    return length;
+  else
+    return _sformat_GetEscapedStringMaxBytes(length, fs) + length;
+}
+
+// Every byte of an invalid UTF-8 sequence may be replaced by U+FFFD.
+constexpr size_t _sformat_MaxRepairedBytesPerByte = sizeof("\xEF\xBF\xBD") - 1;
+
+inline size_t _sformat_GetStringMaxBytes(const size_t length, const sformatState &fs)
+{
+  if (!fs.stringValidateUtf8)
+    return _sformat_GetCaseConvertedStringMaxBytes(length, fs);
+
+  const size_t maxRepairedBytes = length * _sformat_MaxRepairedBytesPerByte;
+
+  // Invalid strings that may have to be padded, truncated, converted or escaped are repaired behind the output first.
+  if (fs.minChars == 0 && fs.maxChars >= maxRepairedBytes && fs.stringEscape == FEO_None && fs.stringCase == FCO_None)
+    return maxRepairedBytes;
+  else
+    return _sformat_GetCaseConvertedStringMaxBytes(maxRepairedBytes, fs) + maxRepairedBytes;
+}
+
+inline size_t _sformat_GetWideStringMaxBytes(const size_t maxUtf8Bytes, const sformatState &fs)
+{
+  // Strings that may have to be padded, truncated, converted or escaped are transcoded behind the output first. Transcoded strings are always valid UTF-8.
+  if (fs.minChars == 0 && fs.maxChars >= maxUtf8Bytes && fs.stringEscape == FEO_None && fs.stringCase == FCO_None)
+    return maxUtf8Bytes;
+  else
+    return _sformat_GetCaseConvertedStringMaxBytes(maxUtf8Bytes, fs) + maxUtf8Bytes;
+}
+
+template <typename T>
+inline size_t _sformat_GetWideStringLength(const T *string, const size_t maxLength)
+{
+  size_t length = 0;
+
+  while (length < maxLength && string[length] != 0)
+    length++;
+
+  return length;
+}
 
 inline size_t sformat_GetCount(const char *value, const sformatState &fs)
 {
   if (value == nullptr)
     return 0;
 
-  return _clamp(_sformat_GetStringCount(value, strlen(value)), fs.minChars, fs.maxChars);
+  return _clamp(_sformat_GetFormattedStringColumns(value, strlen(value), fs), fs.minChars, fs.maxChars);
 }
 
 template <typename T, typename std::enable_if<std::is_same<T, char *>::value>::type * = nullptr>
@@ -573,7 +880,7 @@ inline size_t sformat_GetMaxBytes(T value, const sformatState &fs)
   if (value == nullptr)
     return 0;
 
-  return _clamp(strlen(value), fs.minChars * 4, fs.maxChars * 4);
+  return _sformat_GetStringMaxBytes(strlen(value), fs);
 }
 
 template <typename T, typename std::enable_if<std::is_same<T, const char *>::value>::type * = nullptr>
@@ -582,61 +889,85 @@ inline size_t sformat_GetMaxBytes(T value, const sformatState &fs)
   if (value == nullptr)
     return 0;
 
-  return _clamp(strlen(value), fs.minChars * 4, fs.maxChars * 4);
+  return _sformat_GetStringMaxBytes(strlen(value), fs);
 }
 
-template <typename T, typename std::enable_if<std::is_same<T, const wchar_t *>::value>::type * = nullptr>
+template <typename T, typename std::enable_if<std::is_pointer<T>::value && _isWideChar_t<typename std::remove_cv<typename std::remove_pointer<T>::type>::type>::value>::type * = nullptr>
 inline size_t sformat_GetMaxBytes(const T value, const sformatState &fs)
 {
-  if (value == nullptr)
-    return 0;
-
-  return _clamp(wcslen(value) * mString_MaxUtf16CharInUtf8Chars + 1, fs.minChars * 4, fs.maxChars * 4);
-}
+  typedef typename std::remove_cv<typename std::remove_pointer<T>::type>::type char_type;
 
-template <typename T, typename std::enable_if<std::is_same<T, wchar_t *>::value>::type * = nullptr>
-inline size_t sformat_GetMaxBytes(const T value, const sformatState &fs)
-{
   if (value == nullptr)
     return 0;
 
-  return _clamp(wcslen(value) * mString_MaxUtf16CharInUtf8Chars + 1, fs.minChars * 4, fs.maxChars * 4);
+  return _sformat_GetWideStringMaxBytes(std::char_traits<char_type>::length(value) * _sformat_MaxUtf8BytesPerCodeUnit<char_type>, fs);
 }
 
 template <size_t TCount>
 inline size_t sformat_GetCount(char(&value)[TCount], const sformatState &fs)
 {
-  return _clamp(_sformat_GetStringCount(value, TCount), fs.minChars, fs.maxChars);
+  return _clamp(_sformat_GetFormattedStringColumns(value, TCount, fs), fs.minChars, fs.maxChars);
 }
 
 template <size_t TCount>
 inline size_t sformat_GetMaxBytes(char(&)[TCount], const sformatState &fs)
 {
-  return _clamp(TCount, fs.minChars * 4, fs.maxChars * 4);
+  return _sformat_GetStringMaxBytes(TCount, fs);
 }
 
-template <size_t TCount>
-inline size_t sformat_GetMaxBytes(wchar_t(&)[TCount], const sformatState &fs)
+template <typename T, size_t TCount, typename std::enable_if<_isWideChar_t<T>::value>::type * = nullptr>
+inline size_t sformat_GetMaxBytes(T(&)[TCount], const sformatState &fs)
 {
-  return _clamp(TCount * mString_MaxUtf16CharInUtf8Chars + 1, fs.minChars * 4, fs.maxChars * 4);
+  return _sformat_GetWideStringMaxBytes(TCount * _sformat_MaxUtf8BytesPerCodeUnit<T>, fs);
 }
 
 template <size_t TCount>
 inline size_t sformat_GetCount(const char(&value)[TCount], const sformatState &fs)
 {
-  return _clamp(_sformat_GetStringCount(value, TCount), fs.minChars, fs.maxChars);
+  return _clamp(_sformat_GetFormattedStringColumns(value, TCount, fs), fs.minChars, fs.maxChars);
 }
 
 template <size_t TCount>
 inline size_t sformat_GetMaxBytes(const char(&)[TCount], const sformatState &fs)
 {
-  return _clamp(TCount, fs.minChars * 4, fs.maxChars * 4);
+  return _sformat_GetStringMaxBytes(TCount, fs);
 }
 
-template <size_t TCount>
-inline size_t sformat_GetMaxBytes(const wchar_t(&)[TCount], const sformatState &fs)
+template <typename T, size_t TCount, typename std::enable_if<_isWideChar_t<T>::value>::type * = nullptr>
+inline size_t sformat_GetMaxBytes(const T(&)[TCount], const sformatState &fs)
+{
+  return _sformat_GetWideStringMaxBytes(TCount * _sformat_MaxUtf8BytesPerCodeUnit<T>, fs);
+}
+
+template <typename T, typename std::enable_if<_isStdString_t<T>::value>::type * = nullptr>
+inline size_t sformat_GetCount(const T &value, const sformatState &fs)
+{
+  return _clamp(_sformat_GetFormattedStringColumns(reinterpret_cast<const char *>(value.data()), value.length(), fs), fs.minChars, fs.maxChars);
+}
+
+template <typename T, typename std::enable_if<_isStdString_t<T>::value>::type * = nullptr>
+inline size_t sformat_GetMaxBytes(const T &value, const sformatState &fs)
+{
+  return _sformat_GetStringMaxBytes(value.length(), fs);
+}
+
+template <typename T, typename std::enable_if<_isStdWideString_t<T>::value>::type * = nullptr>
+inline size_t sformat_GetMaxBytes(const T &value, const sformatState &fs)
 {
-  return _clamp(TCount * mString_MaxUtf16CharInUtf8Chars + 1, fs.minChars * 4, fs.maxChars * 4);
+  return _sformat_GetWideStringMaxBytes(value.length() * _sformat_MaxUtf8BytesPerCodeUnit<typename T::value_type>, fs);
+}
+
+inline size_t sformat_GetCount(const sformatLiteral &value, const sformatState &fs)
+{
+  if (fs.stringDisplayWidth || fs.stringEscape != FEO_None || fs.stringValidateUtf8)
+    return _clamp(_sformat_GetFormattedStringColumns(value.string, value.length, fs), fs.minChars, fs.maxChars);
+  else
+    return _clamp(value.count, fs.minChars, fs.maxChars);
+}
+
+inline size_t sformat_GetMaxBytes(const sformatLiteral &value, const sformatState &fs)
+{
+  return _sformat_GetStringMaxBytes(value.length, fs);
 }
 
 template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value && !std::is_same<bool, T>::value>::type * = nullptr>
@@ -823,8 +1154,14 @@ inline size_t sformat_GetMaxBytes(const float_t, const sformatState &fs)
 {
   constexpr size_t maxDigits = sizeof("340282346638528859811704183484516925440") - 1;
 
+  if (fs.hexFloat)
+    return _clamp(sizeof("-0x1.FFFFFEp-126") - 1, fs.minChars, fs.maxChars);
+
+  if (fs.shortestFloatNotation) // fixed notation is only chosen if it isn't longer than scientific notation.
+    return _clamp(1 + 9 + fs.decimalSeparatorLength + 1 + 1 + 2, fs.minChars, fs.maxChars); // sign + digits + decimalSeparator + e + sign + exponent.
+
   if (fs.scientificNotation)
-    return _clamp(1 + 1 + fs.decimalSeparatorLength + fs.fractionalDigits + 1 + 1 + 10, fs.minChars, _max(fs.maxChars, 6ULL)); // sign + digit + decimalSeparator + decimalDigits + e + sign + exponent.
+    return _clamp(1 + 1 + (size_t)fs.engineeringNotation * 2 + fs.decimalSeparatorLength + fs.fractionalDigits + 1 + 1 + 10, fs.minChars, _max(fs.maxChars, 6ULL)) + (size_t)fs.siPrefixNotation; // sign + digit(s) + decimalSeparator + decimalDigits + e + sign + exponent (+ second byte of 'µ', which is only counted as one char).
   else
     return _clamp(1 /* sign */ + maxDigits + _sformat_GetDigitGroupingCharCount(maxDigits, fs) * fs.digitGroupingCharLength + fs.decimalSeparatorLength + fs.fractionalDigits, fs.minChars, fs.maxChars);
 }
@@ -833,8 +1170,14 @@ inline size_t sformat_GetMaxBytes(const double_t, const sformatState &fs)
 {
   constexpr size_t maxDigits = sizeof("179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368") - 1;
 
+  if (fs.hexFloat)
+    return _clamp(sizeof("-0x1.FFFFFFFFFFFFFp-1022") - 1, fs.minChars, fs.maxChars);
+
+  if (fs.shortestFloatNotation) // fixed notation is only chosen if it isn't longer than scientific notation.
+    return _clamp(1 + 17 + fs.decimalSeparatorLength + 1 + 1 + 3, fs.minChars, fs.maxChars); // sign + digits + decimalSeparator + e + sign + exponent.
+
   if (fs.scientificNotation)
-    return _clamp(1 + 1 + fs.decimalSeparatorLength + fs.fractionalDigits + 1 + 1 + 10, fs.minChars, _max(fs.maxChars, 7ULL)); // sign + digit + decimalSeparator + decimalDigits + e + sign + exponent.
+    return _clamp(1 + 1 + (size_t)fs.engineeringNotation * 2 + fs.decimalSeparatorLength + fs.fractionalDigits + 1 + 1 + 10, fs.minChars, _max(fs.maxChars, 7ULL)) + (size_t)fs.siPrefixNotation; // sign + digit(s) + decimalSeparator + decimalDigits + e + sign + exponent (+ second byte of 'µ', which is only counted as one char).
   else
     return _clamp(1 /* sign */ + maxDigits + _sformat_GetDigitGroupingCharCount(maxDigits, fs) * fs.digitGroupingCharLength + fs.decimalSeparatorLength + fs.fractionalDigits, fs.minChars, fs.maxChars);
 }
@@ -905,37 +1248,40 @@ size_t _sformat_Append(const uint64_t value, const sformatState &fs, char *text)
 size_t _sformat_Append(const float_t value, const sformatState &fs, char *text);
 size_t _sformat_Append(const double_t value, const sformatState &fs, char *text);
 size_t _sformat_Append(const wchar_t value, const sformatState &fs, char *text);
+size_t _sformat_Append(const char16_t value, const sformatState &fs, char *text);
+size_t _sformat_Append(const char32_t value, const sformatState &fs, char *text);
 
 size_t _sformat_AppendWStringWithLength(const wchar_t *string, const size_t charCount, const sformatState &fs, char *text);
+size_t _sformat_AppendWStringWithLength(const char16_t *string, const size_t charCount, const sformatState &fs, char *text);
+size_t _sformat_AppendWStringWithLength(const char32_t *string, const size_t charCount, const sformatState &fs, char *text);
 
-template <typename T, typename std::enable_if<std::is_same<T, wchar_t *>::value>::type * = nullptr>
+template <typename T, typename std::enable_if<std::is_pointer<T>::value && _isWideChar_t<typename std::remove_cv<typename std::remove_pointer<T>::type>::type>::value>::type * = nullptr>
 inline size_t _sformat_Append(const T value, const sformatState &fs, char *text)
 {
+  typedef typename std::remove_cv<typename std::remove_pointer<T>::type>::type char_type;
+
   if (value == nullptr)
     return 0;
 
-  return _sformat_AppendWStringWithLength(value, wcslen(value), fs, text);
+  return _sformat_AppendWStringWithLength(value, std::char_traits<char_type>::length(value), fs, text);
 }
 
-template <typename T, typename std::enable_if<std::is_same<T, const wchar_t *>::value>::type * = nullptr>
-inline size_t _sformat_Append(const T value, const sformatState &fs, char *text)
+template <typename T, size_t TCount, typename std::enable_if<_isWideChar_t<T>::value>::type * = nullptr>
+inline size_t _sformat_Append(T(&value)[TCount], const sformatState &fs, char *text)
 {
-  if (value == nullptr)
-    return 0;
-
-  return _sformat_AppendWStringWithLength(value, wcslen(value), fs, text);
+  return _sformat_AppendWStringWithLength(value, _sformat_GetWideStringLength(value, TCount), fs, text);
 }
 
-template <size_t TCount>
-inline size_t _sformat_Append(wchar_t(&value)[TCount], const sformatState &fs, char *text)
+template <typename T, size_t TCount, typename std::enable_if<_isWideChar_t<T>::value>::type * = nullptr>
+inline size_t _sformat_Append(const T(&value)[TCount], const sformatState &fs, char *text)
 {
-  return _sformat_AppendWStringWithLength(value, wcsnlen_s(value, TCount), fs, text);
+  return _sformat_AppendWStringWithLength(value, _sformat_GetWideStringLength(value, TCount), fs, text);
 }
 
-template <size_t TCount>
-inline size_t _sformat_Append(const wchar_t(&value)[TCount], const sformatState &fs, char *text)
+template <typename T, typename std::enable_if<_isStdWideString_t<T>::value>::type * = nullptr>
+inline size_t _sformat_Append(const T &value, const sformatState &fs, char *text)
 {
-  return _sformat_AppendWStringWithLength(value, wcsnlen_s(value, TCount), fs, text);
+  return _sformat_AppendWStringWithLength(value.data(), value.length(), fs, text);
 }
 
 size_t _sformat_AppendBool(const bool value, const sformatState &fs, char *text);
@@ -954,6 +1300,7 @@ inline size_t _sformat_Append(const uint16_t value, const sformatState &fs, char
 inline size_t _sformat_Append(const uint8_t value, const sformatState &fs, char *text) { return _sformat_Append((uint64_t)value, fs, text); }
 
 size_t _sformat_AppendStringWithLength(const char *value, const size_t length, const sformatState &fs, char *text);
+size_t _sformat_AppendEscapedStringWithLength(const char *value, const size_t length, const sformatState &fs, char *text);
 
 template <size_t TCount>
 inline size_t _sformat_Append(char(&value)[TCount], const sformatState &fs, char *text)
@@ -995,8 +1342,23 @@ inline size_t _sformat_Append(const T value, const sformatState &fs, char *text)
   return _sformat_AppendStringWithLength(value, length, fs, text);
 }
 
+template <typename T, typename std::enable_if<_isStdString_t<T>::value>::type * = nullptr>
+inline size_t _sformat_Append(const T &value, const sformatState &fs, char *text)
+{
+  return _sformat_AppendStringWithLength(reinterpret_cast<const char *>(value.data()), value.length(), fs, text);
+}
+
 size_t _sformat_AppendInplaceString(const char *string, const size_t count, const size_t length, const sformatState &fs, char *text);
 
+inline size_t _sformat_Append(const sformatLiteral &value, const sformatState &fs, char *text)
+{
+  // The display width, escaped & case converted length aren't known at compile time. Literals may contain invalid UTF-8 escape sequences.
+  if (fs.stringDisplayWidth || fs.stringEscape != FEO_None || fs.stringValidateUtf8 || fs.stringCase != FCO_None)
+    return _sformat_AppendStringWithLength(value.string, value.length, fs, text);
+  else
+    return _sformat_AppendInplaceString(value.string, value.count + 1, value.length + 1, fs, text);
+}
+
 template <typename T>
 size_t _sformat_GetMaxBytes(const sformatState &fs, const T &param)
 {
@@ -1025,80 +1387,366 @@ size_t _sformat_Append_Internal(const sformatState &fs, char *text, const T &par
   return offset + _sformat_Append_Internal(fs, text, args...);
 }
 
-// sformat is a general purpose replacement for sprintf() (to char *). The buffer that is returned will be overwritten whenever sformat is called by the same thread. Please don't pass around the returned pointer. The returned pointer does not need to be `free`d.
-template <typename... Args>
-inline const char *sformat(Args && ...args)
-{
-  sformatState &fs = sformat_GetState();
+constexpr size_t _sformat_FormatFailed = (size_t)-1;
+constexpr char _sformat_AllocationFailureMessage[] = "<ERROR: MEMORY_ALLOCATION_FAILURE>";
 
-  if (fs.inFormatStatement)
-  {
-    assert(false && "Recursive sformat is not supported.");
-    return "";
-  }
+template <typename T, typename ... Args>
+struct _sformatType_Wrapper;
 
-  fs.inFormatStatement = true;
+template <typename T, typename ... Args>
+struct _sformatTypeInstance_Wrapper;
 
-  fs.textPosition = 0;
+template <typename T, typename ... Args>
+std::true_type _sformat_IsTypeInstanceWrapper(const _sformatTypeInstance_Wrapper<T, Args...> *);
+std::false_type _sformat_IsTypeInstanceWrapper(const void *);
 
-  const size_t maxCapacityRequired = _sformat_GetMaxBytes(fs, args...) + 1;
+// `FInt`, `FDouble`, etc. derive from `_sformatTypeInstance_Wrapper`, so they'd otherwise prefer overloads for `const T &`.
+template <typename T>
+struct _isTypeInstanceWrapper_t : decltype(_sformat_IsTypeInstanceWrapper(std::declval<const T *>())) {};
 
-  if (fs.textCapacity < maxCapacityRequired)
+// Formats `param` if it's guaranteed to fit into `remainingBytes` & returns `_sformat_FormatFailed` otherwise. C strings are only measured once.
+template <typename T, typename std::enable_if<!_isTypeInstanceWrapper_t<T>::value>::type * = nullptr>
+inline size_t _sformat_OptimisticAppend(const T &param, const sformatState &fs, char *text, const size_t remainingBytes)
+{
+  if constexpr (std::is_same<T, const char *>::value || std::is_same<T, char *>::value)
   {
-    const size_t nextCapacity = (maxCapacityRequired + (maxCapacityRequired - fs.textCapacity) * 2 + 1023) & ~(size_t)1023;
+    if (param == nullptr)
+      return 0;
 
-    if (!fs.pAllocator->realloc(reinterpret_cast<void **>(&fs.textStart), nextCapacity))
-    {
-      fs.inFormatStatement = false;
-      return "<ERROR: MEMORY_ALLOCATION_FAILURE>";
-    }
+    const size_t length = strlen(param);
 
-    fs.textCapacity = nextCapacity;
-  }
+    if (_sformat_GetStringMaxBytes(length, fs) > remainingBytes)
+      return _sformat_FormatFailed;
+
+    return _sformat_AppendStringWithLength(param, length, fs, text);
+  }
+  else
+  {
+    if (sformat_GetMaxBytes(param, fs) > remainingBytes)
+      return _sformat_FormatFailed;
+
+    return _sformat_Append(param, fs, text);
+  }
+}
+
+template <typename T>
+inline size_t _sformat_OptimisticAppend_Internal(const sformatState &fs, char *text, const size_t remainingBytes, const T &param)
+{
+  return _sformat_OptimisticAppend(param, fs, text, remainingBytes);
+}
+
+template <typename T, typename... Args>
+inline size_t _sformat_OptimisticAppend_Internal(const sformatState &fs, char *text, const size_t remainingBytes, const T &param, Args && ... args)
+{
+  const size_t offset = _sformat_OptimisticAppend(param, fs, text, remainingBytes);
+
+  if (offset == _sformat_FormatFailed)
+    return _sformat_FormatFailed;
+
+  const size_t remainingSize = _sformat_OptimisticAppend_Internal(fs, text + offset, remainingBytes - offset, args...);
+
+  if (remainingSize == _sformat_FormatFailed)
+    return _sformat_FormatFailed;
+
+  return offset + remainingSize;
+}
+
+void _sformat_ShrinkThreadBuffer(sformatState &fs);
+
+// Called before the thread local buffer is reused with the number of bytes the previous call used (`fs.textPosition`), so a buffer that only grew for a few large outputs doesn't stay large forever.
+inline void _sformat_TrackThreadBufferUsage(sformatState &fs)
+{
+  if (fs.textShrinkCallCount == 0 || fs.textCapacity <= fs.textShrinkMinCapacity)
+    return;
+
+  if (fs.textPosition > fs.textCapacity / 4)
+  {
+    fs.textUnderusedCalls = 0;
+    fs.textUnderusedMaxPosition = 0;
+    return;
+  }
+
+  fs.textUnderusedMaxPosition = _max(fs.textUnderusedMaxPosition, fs.textPosition);
+
+  if (++fs.textUnderusedCalls >= fs.textShrinkCallCount)
+    _sformat_ShrinkThreadBuffer(fs);
+}
+
+bool _sformat_ReallocThreadBuffer(sformatState &fs, const size_t capacity);
+size_t _sformat_GetNextThreadBufferCapacity(const sformatState &fs, const size_t capacityRequired);
+
+// Makes sure the thread local buffer can hold at least `capacityRequired` bytes. Returns false if it couldn't be allocated.
+inline bool _sformat_GrowThreadBuffer(sformatState &fs, const size_t capacityRequired)
+{
+  if (fs.textCapacity >= capacityRequired)
+    return true;
+
+  return _sformat_ReallocThreadBuffer(fs, _sformat_GetNextThreadBufferCapacity(fs, capacityRequired));
+}
+
+// Formats into the thread local buffer (leaving space for a null terminator, but not writing it) & returns the number of bytes written or `_sformat_FormatFailed` if called recursively (`fs.inFormatStatement` is still set) or the buffer couldn't be allocated.
+template <typename... Args>
+inline size_t _sformat_FormatToThreadBuffer(sformatState &fs, Args && ...args)
+{
+  if (fs.inFormatStatement)
+  {
+    assert(false && "Recursive sformat is not supported.");
+    return _sformat_FormatFailed;
+  }
+
+  fs.inFormatStatement = true;
+
+  _sformat_TrackThreadBufferUsage(fs);
+
+  fs.textPosition = 0;
+
+  // Sizing all arguments up front costs about as much as formatting small ones, so if the buffer is already large, we only check each argument before formatting it & only start over if one might not fit.
+  if (fs.optimisticFormatting && fs.textCapacity != 0 && fs.textCapacity >= fs.optimisticFormattingMinCapacity)
+  {
+    const size_t size = _sformat_OptimisticAppend_Internal(fs, fs.textStart, fs.textCapacity - 1, args...);
+
+    if (size != _sformat_FormatFailed)
+    {
+      fs.textPosition = size;
+
+      fs.inFormatStatement = false;
+      return size;
+    }
+  }
+
+  const size_t maxCapacityRequired = _sformat_GetMaxBytes(fs, args...) + 1;
+
+  if (!_sformat_GrowThreadBuffer(fs, maxCapacityRequired))
+  {
+    fs.inFormatStatement = false;
+    return _sformat_FormatFailed;
+  }
 
   const size_t size = _sformat_Append_Internal(fs, fs.textStart, args...);
 
+  fs.textPosition = size;
+
+  fs.inFormatStatement = false;
+  return size;
+}
+
+// sformat is a general purpose replacement for sprintf() (to char *). The buffer that is returned will be overwritten whenever sformat is called by the same thread. Please don't pass around the returned pointer. The returned pointer does not need to be `free`d.
+template <typename... Args>
+inline const char *sformat(Args && ...args)
+{
+  sformatState &fs = sformat_GetState();
+
+  const size_t size = _sformat_FormatToThreadBuffer(fs, args...);
+
+  if (size == _sformat_FormatFailed)
+    return fs.inFormatStatement ? "" : _sformat_AllocationFailureMessage;
+
   fs.textStart[size] = '\0';
   fs.textPosition = size + 1;
 
-  fs.inFormatStatement = false;
   return fs.textStart;
 }
 
-template <typename ...Args>
-inline size_t sformat_capacity(Args && ...args)
+// The (null terminated) result of `sformat_view` & its length. Like the pointer returned by `sformat`, it's only valid until sformat is called by the same thread again.
+struct sformatView
 {
-  return _sformat_GetMaxBytes(sformat_GetState(), args...) + 1;
+  const char *text = "";
+  size_t length = 0;
+
+  inline operator std::string_view() const
+  {
+    return std::string_view(text, length);
+  }
+};
+
+// Like `sformat`, but also returns the length of the result, so it doesn't have to be measured again.
+template <typename... Args>
+inline sformatView sformat_view(Args && ...args)
+{
+  sformatState &fs = sformat_GetState();
+
+  const size_t size = _sformat_FormatToThreadBuffer(fs, args...);
+
+  if (size == _sformat_FormatFailed)
+  {
+    if (fs.inFormatStatement)
+      return sformatView();
+    else
+      return sformatView{ _sformat_AllocationFailureMessage, sizeof(_sformat_AllocationFailureMessage) - 1 };
+  }
+
+  fs.textStart[size] = '\0';
+  fs.textPosition = size + 1;
+
+  return sformatView{ fs.textStart, size };
 }
 
-template <typename ...Args>
-inline bool sformat_to(char *destination, const size_t capacity, Args && ...args)
+bool _sformat_WriteToFileDescriptor(const int fd, const char *text, const size_t length);
+
+// Formats into the thread local buffer & writes the result to the file descriptor `fd` (without null terminator). Returns false if formatting or writing failed.
+template <typename... Args>
+inline bool sformat_write(const int fd, Args && ...args)
 {
-  if (destination == nullptr)
+  sformatState &fs = sformat_GetState();
+
+  const size_t size = _sformat_FormatToThreadBuffer(fs, args...);
+
+  if (size == _sformat_FormatFailed)
+    return false;
+
+  return _sformat_WriteToFileDescriptor(fd, fs.textStart, size);
+}
+
+// Writes the result of `sformat_view` to the file descriptor `fd` (without null terminator). Returns false if writing failed.
+inline bool sformat_write(const int fd, const sformatView view)
+{
+  return _sformat_WriteToFileDescriptor(fd, view.text, view.length);
+}
+
+// Formats into the thread local buffer & writes the result to `pFile` with a single `fwrite` (without null terminator). Returns false if formatting or writing failed.
+template <typename... Args>
+inline bool sformat_fwrite(FILE *pFile, Args && ...args)
+{
+  if (pFile == nullptr)
     return false;
 
   sformatState &fs = sformat_GetState();
 
-  const size_t maxCapacityRequired = _sformat_GetMaxBytes(fs, args...) + 1;
-  const bool fitsInPlace = maxCapacityRequired <= capacity;
+  const size_t size = _sformat_FormatToThreadBuffer(fs, args...);
+
+  if (size == _sformat_FormatFailed)
+    return false;
+
+  return fwrite(fs.textStart, 1, size, pFile) == size;
+}
+
+// Writes the result of `sformat_view` to `pFile` (without null terminator). Returns false if writing failed.
+inline bool sformat_fwrite(FILE *pFile, const sformatView view)
+{
+  if (pFile == nullptr)
+    return false;
+
+  return fwrite(view.text, 1, view.length, pFile) == view.length;
+}
 
-  if (fitsInPlace)
+// Writes everything that was buffered by `sformat_buffered_print` on the calling thread to `bufferedPrintFileDescriptor` with a single `write`. Returns false if writing failed (the buffered output is discarded either way).
+bool sformat_flush();
+
+bool _sformat_PrepareBufferedPrint(sformatState &fs, const size_t maxBytes, bool &fits);
+bool _sformat_FinishBufferedPrint(sformatState &fs);
+bool _sformat_FlushToFileDescriptor(void *pUserData, const char *text, const size_t length);
+
+template <typename ...Args>
+inline bool sformat_stream(const sformat_sink &sink, Args && ...args);
+
+// Formats & appends to a separate thread local buffer, which is only written to `bufferedPrintFileDescriptor` once the next message might not fit into `bufferedPrintFlushBytes`, a message is printed while its oldest message is older than `bufferedPrintMaxAgeMs` (which isn't checked in between calls, so call `sformat_flush` on idle or shutdown paths), `sformat_flush` is called or the thread exits. Messages that are larger than the buffer are streamed through it on their own (after everything that was buffered), so only their arguments that can't be split into pieces (see `sformat_stream`) are formatted into the thread local buffer. Returns false if formatting or writing failed.
+template <typename... Args>
+inline bool sformat_buffered_print(Args && ...args)
+{
+  sformatState &fs = sformat_GetState();
+
+  if (fs.inFormatStatement)
   {
-    const size_t length = _sformat_Append_Internal(fs, destination, args...);
-    destination[length] = '\0';
+    assert(false && "Recursive sformat is not supported.");
+    return false;
   }
-  else
+
+  bool fits;
+
+  if (!_sformat_PrepareBufferedPrint(fs, _sformat_GetMaxBytes(fs, args...), fits))
+    return false;
+
+  if (!fits)
   {
-    const char *result = sformat(args...);
-    const size_t length = fs.textPosition;
+    // Without a buffer (`bufferedPrintFlushBytes` is 0 or it couldn't be allocated), the message is written directly.
+    if (fs.printBufferCapacity == 0)
+      return sformat_write(fs.bufferedPrintFileDescriptor, args...);
 
-    if (result == nullptr || length == 0 || capacity < length)
-      return false;
+    const sformat_sink sink{ fs.printBufferStart, fs.printBufferCapacity, _sformat_FlushToFileDescriptor, &fs.bufferedPrintFileDescriptor };
 
-    memcpy(destination, result, length);
+    return sformat_stream(sink, args...);
   }
 
-  return true;
+  fs.inFormatStatement = true;
+
+  fs.printBufferPosition += _sformat_Append_Internal(fs, fs.printBufferStart + fs.printBufferPosition, args...);
+
+  fs.inFormatStatement = false;
+
+  return _sformat_FinishBufferedPrint(fs);
+}
+
+template <typename ...Args>
+inline size_t sformat_capacity(Args && ...args)
+{
+  return _sformat_GetMaxBytes(sformat_GetState(), args...) + 1;
+}
+
+inline bool _sformat_IsWithinString(const std::string &destination, const void *pointer)
+{
+  const uintptr_t start = reinterpret_cast<uintptr_t>(destination.data());
+  const uintptr_t address = reinterpret_cast<uintptr_t>(pointer);
+
+  return address >= start && address <= start + destination.capacity();
+}
+
+// Whether `param` references characters stored in `destination` (like `destination` itself, or a `const char *` / `std::string_view` pointing into it).
+template <typename T>
+inline bool _sformat_AliasesString(const std::string &destination, const T &param)
+{
+  if constexpr (std::is_convertible<const T &, const char *>::value)
+    return _sformat_IsWithinString(destination, static_cast<const char *>(param));
+  else if constexpr (_isStdString_t<T>::value)
+    return _sformat_IsWithinString(destination, param.data());
+  else
+    return false;
+}
+
+template <typename T, typename ... Args>
+inline bool _sformat_AliasesString(const std::string &destination, const _sformatType_Wrapper<T, Args...> &param)
+{
+  return _sformat_AliasesString(destination, param.value);
+}
+
+inline bool _sformat_AnyAliasesString(const std::string &)
+{
+  return false;
+}
+
+template <typename T, typename... Args>
+inline bool _sformat_AnyAliasesString(const std::string &destination, const T &param, Args && ... args)
+{
+  return _sformat_AliasesString(destination, param) || _sformat_AnyAliasesString(destination, args...);
+}
+
+// Appends to `destination` without going through the thread local buffer: `destination` is grown once by the maximum number of required bytes, formatted into directly & trimmed to the actual length afterwards. Returns the number of bytes appended.
+// Arguments referencing `destination` itself (`sformat_append(s, s, "!")`) are formatted into a temporary string first, as growing `destination` would change them while they're being read.
+template <typename ...Args>
+inline size_t sformat_append(std::string &destination, Args && ...args)
+{
+  if (_sformat_AnyAliasesString(destination, args...))
+  {
+    std::string appended;
+    sformat_append(appended, args...);
+    destination.append(appended);
+
+    return appended.length();
+  }
+
+  sformatState &fs = sformat_GetState();
+
+  const size_t previousLength = destination.length();
+  const size_t maxBytes = _sformat_GetMaxBytes(fs, args...);
+
+#ifdef __cpp_lib_string_resize_and_overwrite
+  // Doesn't fill the new bytes with zeroes before overwriting them.
+  destination.resize_and_overwrite(previousLength + maxBytes, [&](char *data, const size_t) { return previousLength + _sformat_Append_Internal(fs, data + previousLength, args...); });
+#else
+  destination.resize(previousLength + maxBytes);
+  destination.resize(previousLength + _sformat_Append_Internal(fs, destination.data() + previousLength, args...));
+#endif
+
+  return destination.length() - previousLength;
 }
 
 template <typename T>
@@ -1213,6 +1861,441 @@ size_t _sformat_Append(const _sformatTypeInstance_Wrapper<T, Args...> &value, co
   return _sformat_Append(value.value, localFS, text);
 }
 
+template <typename T, typename ... Args>
+size_t _sformat_OptimisticAppend(const _sformatType_Wrapper<T, Args...> &value, const sformatState &fs, char *text, const size_t remainingBytes)
+{
+  sformatState localFS(fs);
+
+  _sformat_ApplyFormat<Args...>(localFS);
+
+  return _sformat_OptimisticAppend(value.value, localFS, text, remainingBytes);
+}
+
+template <typename T, typename ... Args>
+size_t _sformat_OptimisticAppend(const _sformatTypeInstance_Wrapper<T, Args...> &value, const sformatState &fs, char *text, const size_t remainingBytes)
+{
+  sformatState localFS(fs);
+
+  _sformat_ApplyFormat<Args...>(localFS);
+
+  return _sformat_OptimisticAppend(value.value, localFS, text, remainingBytes);
+}
+
+struct _sformatStream
+{
+  const sformat_sink &sink;
+  size_t position;
+};
+
+bool _sformat_StreamFlush(_sformatStream &stream);
+bool _sformat_StreamText(_sformatStream &stream, const char *text, const size_t length);
+bool _sformat_StreamString(_sformatStream &stream, const char *value, const size_t length, const sformatState &fs);
+size_t _sformat_GetMaxStringPieceLength(const size_t capacity, const sformatState &fs);
+size_t _sformat_GetStringPieceLength(const char *value, const size_t length, const size_t maxPieceLength);
+
+inline std::string_view _sformat_ToStringView(const char *value)
+{
+  return std::string_view(value);
+}
+
+template <size_t TCount>
+inline std::string_view _sformat_ToStringView(const char(&value)[TCount])
+{
+  return std::string_view(value, strnlen(value, TCount - 1));
+}
+
+template <typename T, typename std::enable_if<_isStdString_t<T>::value>::type * = nullptr>
+inline std::string_view _sformat_ToStringView(const T &value)
+{
+  return std::string_view(reinterpret_cast<const char *>(value.data()), value.length());
+}
+
+inline std::string_view _sformat_ToStringView(const sformatLiteral &value)
+{
+  return std::string_view(value.string, value.length);
+}
+
+template <typename T, typename = void>
+struct _isSplittableString_t : std::false_type {};
+
+template <typename T>
+struct _isSplittableString_t<T, std::void_t<decltype(_sformat_ToStringView(std::declval<const T &>()))>> : std::true_type {};
+
+// Strings can only be split into multiple chunks if they don't have to be padded or truncated.
+inline bool _sformat_IsSplittableString(const size_t length, const sformatState &fs)
+{
+  return fs.minChars == 0 && fs.maxChars >= _sformat_GetStringMaxBytes(length, fs);
+}
+
+// Calls `onString(value, length, fs)` if `param` is a string that can be split into pieces & `otherwise()` if it isn't.
+template <typename T, typename TOnString, typename TOtherwise, typename std::enable_if<!_isSplittableString_t<T>::value>::type * = nullptr>
+inline bool _sformat_VisitSplittableString(const T &, const sformatState &, TOnString &&, TOtherwise &&otherwise)
+{
+  return otherwise();
+}
+
+template <typename T, typename TOnString, typename TOtherwise, typename std::enable_if<_isSplittableString_t<T>::value>::type * = nullptr>
+inline bool _sformat_VisitSplittableString(const T &param, const sformatState &fs, TOnString &&onString, TOtherwise &&otherwise)
+{
+  const std::string_view string = _sformat_ToStringView(param);
+
+  if (_sformat_IsSplittableString(string.length(), fs))
+    return onString(string.data(), string.length(), fs);
+  else
+    return otherwise();
+}
+
+template <typename T, typename ... Args, typename TOnString, typename TOtherwise, typename std::enable_if<_isSplittableString_t<T>::value>::type * = nullptr>
+inline bool _sformat_VisitSplittableString(const _sformatType_Wrapper<T, Args...> &param, const sformatState &fs, TOnString &&onString, TOtherwise &&otherwise)
+{
+  sformatState localFS(fs);
+
+  _sformat_ApplyFormat<Args...>(localFS);
+
+  const std::string_view string = _sformat_ToStringView(param.value);
+
+  if (_sformat_IsSplittableString(string.length(), localFS))
+    return onString(string.data(), string.length(), localFS);
+  else
+    return otherwise();
+}
+
+template <typename T>
+inline bool _sformat_StreamLargeArgument(_sformatStream &stream, sformatState &fs, const T &param)
+{
+  // Arguments that can't be split are formatted into the thread local buffer on their own & streamed from there.
+  const auto streamFromThreadBuffer = [&]()
+  {
+    const size_t length = _sformat_FormatToThreadBuffer(fs, param);
+
+    if (length == _sformat_FormatFailed)
+      return false;
+
+    return _sformat_StreamText(stream, fs.textStart, length);
+  };
+
+  return _sformat_VisitSplittableString(param, fs,
+    [&](const char *value, const size_t length, const sformatState &stringFS)
+    {
+      // Escaped or repaired strings may not even fit a single code point into a small chunk.
+      if (_sformat_GetMaxStringPieceLength(stream.sink.capacity, stringFS) == 0)
+        return streamFromThreadBuffer();
+
+      return _sformat_StreamString(stream, value, length, stringFS);
+    },
+    streamFromThreadBuffer);
+}
+
+template <typename T>
+inline bool _sformat_StreamArgument(_sformatStream &stream, sformatState &fs, const T &param)
+{
+  const size_t maxBytes = sformat_GetMaxBytes(param, fs);
+
+  if (maxBytes > stream.sink.capacity - stream.position && !_sformat_StreamFlush(stream))
+    return false;
+
+  if (maxBytes > stream.sink.capacity)
+    return _sformat_StreamLargeArgument(stream, fs, param);
+
+  stream.position += _sformat_Append(param, fs, stream.sink.chunk + stream.position);
+
+  return true;
+}
+
+template <typename T>
+inline bool _sformat_Stream_Internal(_sformatStream &stream, sformatState &fs, const T &param)
+{
+  return _sformat_StreamArgument(stream, fs, param);
+}
+
+template <typename T, typename... Args>
+inline bool _sformat_Stream_Internal(_sformatStream &stream, sformatState &fs, const T &param, Args && ... args)
+{
+  if (!_sformat_StreamArgument(stream, fs, param))
+    return false;
+
+  return _sformat_Stream_Internal(stream, fs, args...);
+}
+
+// Formats into the fixed size chunk of `sink`, which is passed to `sink.flush` whenever the next argument might not fit (and at the end), so the output doesn't have to fit into memory at once. Strings that are larger than the chunk are split across multiple chunks (unless they have to be padded or truncated, or the chunk is too small for a single escaped code point), other arguments that don't fit into a chunk are formatted into the thread local buffer on their own. Returns false if `flush` returned false or memory couldn't be allocated.
+template <typename ...Args>
+inline bool sformat_stream(const sformat_sink &sink, Args && ...args)
+{
+  if (sink.chunk == nullptr || sink.flush == nullptr)
+    return false;
+
+  _sformatStream stream{ sink, 0 };
+
+  if (!_sformat_Stream_Internal(stream, sformat_GetState(), args...))
+    return false;
+
+  return _sformat_StreamFlush(stream);
+}
+
+struct _sformatBoundedWriter
+{
+  char *destination;
+  size_t limit; // excluding the null terminator.
+  size_t position;
+};
+
+// Arguments that may not fit into the remaining space are formatted into a scratch buffer of this size on the stack first. Large enough for the worst case of `double`s in fixed notation.
+constexpr size_t _sformat_BoundedScratchBytes = 512;
+
+bool _sformat_BoundedCopy(_sformatBoundedWriter &writer, const char *text, const size_t length);
+bool _sformat_BoundedAppendString(_sformatBoundedWriter &writer, const char *value, const size_t length, const sformatState &fs);
+void _sformat_BoundedTruncate(_sformatBoundedWriter &writer, const sformatState &fs);
+
+// Returns false if `param` didn't fit (completely). Only strings are written partially, other arguments (like a number that would be cut off after some of its digits) are left out entirely.
+template <typename T>
+inline bool _sformat_BoundedAppendArgument(_sformatBoundedWriter &writer, sformatState &fs, const T &param)
+{
+  const size_t maxBytes = sformat_GetMaxBytes(param, fs);
+
+  if (maxBytes <= writer.limit - writer.position)
+  {
+    writer.position += _sformat_Append(param, fs, writer.destination + writer.position);
+    return true;
+  }
+
+  if (maxBytes <= _sformat_BoundedScratchBytes)
+  {
+    char scratch[_sformat_BoundedScratchBytes];
+    const size_t length = _sformat_Append(param, fs, scratch);
+
+    if (length <= writer.limit - writer.position)
+      return _sformat_BoundedCopy(writer, scratch, length);
+
+    return _sformat_VisitSplittableString(param, fs,
+      [&](const char *, const size_t, const sformatState &) { return _sformat_BoundedCopy(writer, scratch, length); },
+      []() { return false; });
+  }
+
+  return _sformat_VisitSplittableString(param, fs,
+    [&](const char *value, const size_t length, const sformatState &stringFS) { return _sformat_BoundedAppendString(writer, value, length, stringFS); },
+    [&]()
+    {
+      // Other large arguments may only use the thread local buffer if it doesn't have to grow.
+      if (fs.inFormatStatement || fs.textCapacity < maxBytes + 1)
+        return false;
+
+      const size_t length = _sformat_FormatToThreadBuffer(fs, param);
+
+      if (length == _sformat_FormatFailed || length > writer.limit - writer.position)
+        return false;
+
+      return _sformat_BoundedCopy(writer, fs.textStart, length);
+    });
+}
+
+template <typename T>
+inline bool _sformat_BoundedAppend_Internal(_sformatBoundedWriter &writer, sformatState &fs, const T &param)
+{
+  return _sformat_BoundedAppendArgument(writer, fs, param);
+}
+
+template <typename T, typename... Args>
+inline bool _sformat_BoundedAppend_Internal(_sformatBoundedWriter &writer, sformatState &fs, const T &param, Args && ... args)
+{
+  if (!_sformat_BoundedAppendArgument(writer, fs, param))
+    return false;
+
+  return _sformat_BoundedAppend_Internal(writer, fs, args...);
+}
+
+// Formats into `destination` (including a null terminator). If the result may not fit into `capacity`, every argument is bounds checked & the output is truncated (ending with `truncationMarkerChars` of the current state) as soon as one doesn't fit: strings are cut off at a code point boundary, other arguments are left out entirely. Returns false if the output was truncated.
+template <typename ...Args>
+inline bool sformat_to(char *destination, const size_t capacity, Args && ...args)
+{
+  if (destination == nullptr || capacity == 0)
+    return false;
+
+  sformatState &fs = sformat_GetState();
+
+  const size_t maxCapacityRequired = _sformat_GetMaxBytes(fs, args...) + 1;
+
+  if (maxCapacityRequired <= capacity)
+  {
+    const size_t length = _sformat_Append_Internal(fs, destination, args...);
+    destination[length] = '\0';
+
+    return true;
+  }
+
+  _sformatBoundedWriter writer{ destination, capacity - 1, 0 };
+
+  const bool complete = _sformat_BoundedAppend_Internal(writer, fs, args...);
+
+  if (!complete)
+    _sformat_BoundedTruncate(writer, fs);
+
+  destination[writer.position] = '\0';
+
+  return complete;
+}
+
+#ifdef _WIN32
+struct sformatIOVec
+{
+  void *iov_base;
+  size_t iov_len;
+};
+#else
+typedef struct iovec sformatIOVec;
+#endif
+
+// The result of `sformat_iovec`. The formatted pieces are only valid until sformat is called by the same thread again, referenced strings as long as the arguments are.
+template <size_t TMaxCount>
+struct sformatIOVecs
+{
+  sformatIOVec vectors[TMaxCount];
+  size_t count = 0;
+  size_t length = 0; // of all vectors combined.
+};
+
+struct _sformatIOVecWriter
+{
+  sformatIOVec *pVectors;
+  size_t count;
+  char *text;
+  size_t position;
+  size_t pieceStart; // of the formatted text that isn't part of a vector yet.
+};
+
+void _sformat_IOVecReference(_sformatIOVecWriter &writer, const char *value, const size_t length);
+void _sformat_IOVecFinish(_sformatIOVecWriter &writer);
+
+inline bool _sformat_IsReferenceableString(const size_t length, const sformatState &fs)
+{
+  return length != 0 && length >= fs.ioVectorMinReferenceBytes && !fs.stringValidateUtf8 && fs.stringEscape == FEO_None && fs.stringCase == FCO_None;
+}
+
+// Returns the number of bytes `param` requires in the thread local buffer.
+template <typename T>
+inline size_t _sformat_GetIOVecMaxBytes(const T &param, const sformatState &fs)
+{
+  size_t maxBytes = 0;
+
+  _sformat_VisitSplittableString(param, fs,
+    [&](const char *, const size_t length, const sformatState &stringFS)
+    {
+      if (!_sformat_IsReferenceableString(length, stringFS))
+        maxBytes = sformat_GetMaxBytes(param, fs);
+
+      return true;
+    },
+    [&]()
+    {
+      maxBytes = sformat_GetMaxBytes(param, fs);
+      return true;
+    });
+
+  return maxBytes;
+}
+
+template <typename T>
+inline size_t _sformat_GetIOVecMaxBytes_Internal(const sformatState &fs, const T &param)
+{
+  return _sformat_GetIOVecMaxBytes(param, fs);
+}
+
+template <typename T, typename... Args>
+inline size_t _sformat_GetIOVecMaxBytes_Internal(const sformatState &fs, const T &param, Args && ... args)
+{
+  return _sformat_GetIOVecMaxBytes(param, fs) + _sformat_GetIOVecMaxBytes_Internal(fs, args...);
+}
+
+template <typename T>
+inline void _sformat_IOVecAppendArgument(_sformatIOVecWriter &writer, const sformatState &fs, const T &param)
+{
+  _sformat_VisitSplittableString(param, fs,
+    [&](const char *value, const size_t length, const sformatState &stringFS)
+    {
+      if (_sformat_IsReferenceableString(length, stringFS))
+        _sformat_IOVecReference(writer, value, length);
+      else
+        writer.position += _sformat_Append(param, fs, writer.text + writer.position);
+
+      return true;
+    },
+    [&]()
+    {
+      writer.position += _sformat_Append(param, fs, writer.text + writer.position);
+      return true;
+    });
+}
+
+template <typename T>
+inline void _sformat_IOVecAppend_Internal(_sformatIOVecWriter &writer, const sformatState &fs, const T &param)
+{
+  _sformat_IOVecAppendArgument(writer, fs, param);
+}
+
+template <typename T, typename... Args>
+inline void _sformat_IOVecAppend_Internal(_sformatIOVecWriter &writer, const sformatState &fs, const T &param, Args && ... args)
+{
+  _sformat_IOVecAppendArgument(writer, fs, param);
+  _sformat_IOVecAppend_Internal(writer, fs, args...);
+}
+
+// Formats into the thread local buffer like `sformat`, but large strings (see `ioVectorMinReferenceBytes`) aren't copied & referenced in the resulting vectors instead, which can be passed to `writev` or `sformat_write`. Returns no vectors if called recursively.
+template <typename... Args>
+inline sformatIOVecs<sizeof...(Args) * 2 + 1> sformat_iovec(Args && ...args)
+{
+  sformatIOVecs<sizeof...(Args) * 2 + 1> result;
+
+  sformatState &fs = sformat_GetState();
+
+  if (fs.inFormatStatement)
+  {
+    assert(false && "Recursive sformat is not supported.");
+    return result;
+  }
+
+  fs.inFormatStatement = true;
+
+  _sformat_TrackThreadBufferUsage(fs);
+
+  fs.textPosition = 0;
+
+  // The formatted text must not move once it's referenced by a vector, so the buffer can't grow while formatting.
+  if (!_sformat_GrowThreadBuffer(fs, _sformat_GetIOVecMaxBytes_Internal(fs, args...) + 1))
+  {
+    fs.inFormatStatement = false;
+
+    result.vectors[0].iov_base = const_cast<char *>(_sformat_AllocationFailureMessage);
+    result.vectors[0].iov_len = result.length = sizeof(_sformat_AllocationFailureMessage) - 1;
+    result.count = 1;
+
+    return result;
+  }
+
+  _sformatIOVecWriter writer{ result.vectors, 0, fs.textStart, 0, 0 };
+
+  _sformat_IOVecAppend_Internal(writer, fs, args...);
+  _sformat_IOVecFinish(writer);
+
+  fs.textPosition = writer.position;
+
+  fs.inFormatStatement = false;
+
+  result.count = writer.count;
+
+  for (size_t i = 0; i < result.count; i++)
+    result.length += result.vectors[i].iov_len;
+
+  return result;
+}
+
+bool _sformat_WriteIOVecsToFileDescriptor(const int fd, const sformatIOVec *pVectors, const size_t count);
+
+// Writes the result of `sformat_iovec` to the file descriptor `fd` (with `writev` where available). Returns false if writing failed.
+template <size_t TMaxCount>
+inline bool sformat_write(const int fd, const sformatIOVecs<TMaxCount> vectors)
+{
+  return _sformat_WriteIOVecsToFileDescriptor(fd, vectors.vectors, vectors.count);
+}
+
 template <size_t maxDigits>
 struct FMaxDigits
 {
@@ -1235,6 +2318,12 @@ struct FFractionalDigits
   static void ApplyFormat(sformatState &fs) { fs.fractionalDigits = fractionalDigits; }
 };
 
+template <size_t scale>
+struct FDecimalScale
+{
+  static void ApplyFormat(sformatState &fs) { fs.decimalScale = scale; }
+};
+
 struct FHex
 {
   static void ApplyFormat(sformatState &fs) { fs.integerBaseOption = FBO_Hexadecimal; }
@@ -1340,6 +2429,71 @@ struct FNoEllipsis
   static void ApplyFormat(sformatState &fs) { fs.stringOverflowEllipsis = false; }
 };
 
+struct FDisplayWidth
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringDisplayWidth = true; }
+};
+
+struct FCodePointCount
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringDisplayWidth = false; }
+};
+
+struct FGraphemeClusters
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringGraphemeClusters = true; }
+};
+
+struct FNoGraphemeClusters
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringGraphemeClusters = false; }
+};
+
+struct FEscapeJson
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringEscape = FEO_Json; }
+};
+
+struct FEscapeC
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringEscape = FEO_C; }
+};
+
+struct FEscapeControl
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringEscape = FEO_Control; }
+};
+
+struct FNoEscape
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringEscape = FEO_None; }
+};
+
+struct FUpperCase
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringCase = FCO_Upper; }
+};
+
+struct FLowerCase
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringCase = FCO_Lower; }
+};
+
+struct FNoCaseConversion
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringCase = FCO_None; }
+};
+
+struct FValidateUtf8
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringValidateUtf8 = true; }
+};
+
+struct FNoValidateUtf8
+{
+  static void ApplyFormat(sformatState &fs) { fs.stringValidateUtf8 = false; }
+};
+
 struct FGroupDigits
 {
   static void ApplyFormat(sformatState &fs) { fs.groupDigits = true; }
@@ -1355,6 +2509,26 @@ struct FExponent
   static void ApplyFormat(sformatState &fs) { fs.scientificNotation = true; }
 };
 
+struct FEngineering
+{
+  static void ApplyFormat(sformatState &fs) { fs.scientificNotation = true; fs.engineeringNotation = true; fs.siPrefixNotation = false; }
+};
+
+struct FSIPrefix
+{
+  static void ApplyFormat(sformatState &fs) { fs.scientificNotation = true; fs.engineeringNotation = true; fs.siPrefixNotation = true; }
+};
+
+struct FShortest
+{
+  static void ApplyFormat(sformatState &fs) { fs.shortestFloatNotation = true; }
+};
+
+struct FHexFloat
+{
+  static void ApplyFormat(sformatState &fs) { fs.hexFloat = true; }
+};
+
 struct FExponentAdaptive
 {
   static void ApplyFormat(sformatState &fs) { fs.adaptiveFloatScientificNotation = true; }
@@ -1440,11 +2614,16 @@ struct FFractionalDigitsFixed
 #define _SFORMAT_SHORT_X FHexUppercase
 #define _SFORMAT_SHORT_Bin FBinary
 #define _SFORMAT_SHORT_Frac(k) FFractionalDigits< k >
+#define _SFORMAT_SHORT_Scale(k) FDecimalScale< k >
 #define _SFORMAT_SHORT_Min(k) FMinDigits< k >
 #define _SFORMAT_SHORT_Max(k) FMaxDigits< k >
 #define _SFORMAT_SHORT_Fill0 FFillZeroes
 #define _SFORMAT_SHORT_AllFrac FFractionalDigitsFixed
 #define _SFORMAT_SHORT_Exp FExponent
+#define _SFORMAT_SHORT_Eng FEngineering
+#define _SFORMAT_SHORT_SI FSIPrefix
+#define _SFORMAT_SHORT_Shortest FShortest
+#define _SFORMAT_SHORT_HexFloat FHexFloat
 #define _SFORMAT_SHORT_SBoth FSignBoth
 #define _SFORMAT_SHORT_Center FAlignNumCenter
 #define _SFORMAT_SHORT_Left FAlignNumLeft
@@ -1456,6 +2635,14 @@ struct FFractionalDigitsFixed
 #define _SFORMAT_SHORT_STRING_Center FAlignStringCenter
 #define _SFORMAT_SHORT_STRING_Left FAlignStringLeft
 #define _SFORMAT_SHORT_STRING_Right FAlignStringRight
+#define _SFORMAT_SHORT_STRING_Columns FDisplayWidth
+#define _SFORMAT_SHORT_STRING_Graphemes FGraphemeClusters
+#define _SFORMAT_SHORT_STRING_EscapeJson FEscapeJson
+#define _SFORMAT_SHORT_STRING_EscapeC FEscapeC
+#define _SFORMAT_SHORT_STRING_EscapeControl FEscapeControl
+#define _SFORMAT_SHORT_STRING_Validate FValidateUtf8
+#define _SFORMAT_SHORT_STRING_Upper FUpperCase
+#define _SFORMAT_SHORT_STRING_Lower FLowerCase
 
 #define _CONCAT_LITERALS_INTERNAL(x, y) x ## y
 #define _CONCAT_LITERALS(x, y) _CONCAT_LITERALS_INTERNAL(x, y)
@@ -1476,11 +2663,23 @@ struct FFractionalDigitsFixed
 #define FX_COMMA_OR_EMPTY_8 ,
 #define FX_COMMA_OR_EMPTY_9 ,
 
+#define FL_WITH_OPTIONS_0(literal, ...) literal
+#define FL_WITH_OPTIONS_1(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL_WITH_OPTIONS_2(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL_WITH_OPTIONS_3(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL_WITH_OPTIONS_4(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL_WITH_OPTIONS_5(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL_WITH_OPTIONS_6(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL_WITH_OPTIONS_7(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL_WITH_OPTIONS_8(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL_WITH_OPTIONS_9(literal, ...) FString(literal, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+
 #define FI(...) FInt< _SFORMAT_XX_UNRAVEL(__VA_ARGS__) >
 #define FU(...) FUInt< _SFORMAT_XX_UNRAVEL(__VA_ARGS__) >
 #define FF(...) FFloat< _SFORMAT_XX_UNRAVEL(__VA_ARGS__) >
 #define FD(...) FDouble< _SFORMAT_XX_UNRAVEL(__VA_ARGS__) >
 #define FX(...) FUInt<_SFORMAT_XX_UNRAVEL(Hex _CONCAT_LITERALS(FX_COMMA_OR_EMPTY_, _SFORMAT_ARG_COUNT(__VA_ARGS__)) __VA_ARGS__) >
 #define FS(string, ...) FString(string, _SFORMAT_XX_UNRAVEL_STRING(__VA_ARGS__))
+#define FL(literal, ...) _CONCAT_LITERALS(FL_WITH_OPTIONS_, _SFORMAT_ARG_COUNT(__VA_ARGS__))(([]() { constexpr sformatLiteral _literal(literal); return _literal; }()), __VA_ARGS__)
 
 #endif // sformat_h__
@@ -0,0 +1,63 @@
+ProjectName = "test"
+project(ProjectName)
+
+  --Settings
+  kind "ConsoleApp"
+  language "C++"
+  staticruntime "On"
+
+  dependson { "sformat" }
+  cppdialect "C++17"
+
+  filter { "system:windows" }
+    buildoptions { '/Gm-' }
+    buildoptions { '/MP' }
+
+    ignoredefaultlibraries { "msvcrt" }
+  filter { }
+  
+  defines { "_CRT_SECURE_NO_WARNINGS", "SSE2" }
+  
+  objdir "intermediate/obj"
+
+  files { "src/**.cpp", "src/**.h", "project.lua" }
+  
+  includedirs { "../" }
+
+  links { "../builds/lib/sformat.lib" }
+
+  filter { "configurations:Debug", "system:Windows" }
+    ignoredefaultlibraries { "libcmt" }
+  filter { }
+  
+  targetname(ProjectName)
+  targetdir "../builds/bin"
+  debugdir "../builds/bin"
+  
+filter {}
+configuration {}
+
+warnings "Extra"
+
+filter {"configurations:Release"}
+  targetname "%{prj.name}"
+filter {"configurations:Debug"}
+  targetname "%{prj.name}D"
+
+filter {}
+configuration {}
+flags { "NoMinimalRebuild", "NoPCH" }
+exceptionhandling "Off"
+rtti "Off"
+
+-- Assertions stay enabled in both configurations.
+filter { "configurations:Debug*" }
+	defines { "_DEBUG" }
+	optimize "Off"
+	symbols "On"
+
+filter { "configurations:Release" }
+	optimize "Speed"
+	symbols "On"
+
+editandcontinue "Off"
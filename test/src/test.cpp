@@ -0,0 +1,162 @@
+#include "sformat.h"
+
+#include <random>
+#include <string>
+#include <stdlib.h>
+
+////////////////////////////////////////////////////////////////////////////////
+
+static size_t failures = 0;
+
+void Expect(const bool condition, const char *description)
+{
+  if (condition)
+    return;
+
+  failures++;
+  sformat_fwrite(stderr, "FAILED: ", description, "\n");
+}
+
+void ExpectEqual(const std::string_view actual, const std::string_view expected, const char *description)
+{
+  if (actual == expected)
+    return;
+
+  // `actual` may be the result of `sformat_view`, which `sformat_fwrite` would overwrite.
+  const std::string actualCopy(actual);
+
+  failures++;
+  sformat_fwrite(stderr, "FAILED: ", description, " (got \"", FS(actualCopy, EscapeC), "\", expected \"", FS(expected, EscapeC), "\")\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+// Bytes that are likely to produce truncated, overlong, unexpected or otherwise invalid UTF-8 sequences.
+static const uint8_t InvalidUtf8Bytes[] = { 'a', ' ', '\n', '\r', '\\', '"', 0x7F, 0x80, 0x82, 0x8F, 0xB1, 0xBF, 0xC0, 0xC3, 0xC4, 0xCC, 0xE0, 0xE2, 0xED, 0xF0, 0xF4, 0xF8, 0xFF };
+
+// The output must never exceed `sformat_capacity`, as that's what `sformat_to` & the thread local buffer rely on.
+template <typename T>
+void ExpectWithinCapacity(const std::string &input, const T &param)
+{
+  const size_t capacity = sformat_capacity(param);
+  std::string buffer(capacity, '\0');
+
+  sformat_to(buffer.data(), capacity, param);
+
+  if (strnlen(buffer.data(), capacity) < capacity && sformat_view(param).length < capacity)
+    return;
+
+  failures++;
+  sformat_fwrite(stderr, "FAILED: output exceeds capacity of ", capacity, " bytes for \"", FS(input, EscapeC), "\"\n");
+}
+
+void TestInvalidUtf8WithinCapacity()
+{
+  // A broken lead byte used to swallow the following bytes while truncating, so the result exceeded `sformat_capacity`.
+  const char *string = "\xBF\x80\xFF\x81\xB1";
+  ExpectWithinCapacity(string, FS(string, Max(1)));
+
+  std::mt19937 rng(0);
+
+  for (size_t i = 0; i < 10000; i++)
+  {
+    std::string input;
+    const size_t length = rng() % 32;
+
+    for (size_t j = 0; j < length; j++)
+      input += (char)InvalidUtf8Bytes[rng() % sizeof(InvalidUtf8Bytes)];
+
+    string = input.c_str();
+
+    ExpectWithinCapacity(input, FS(string, Max(1)));
+    ExpectWithinCapacity(input, FS(string, Max(3)));
+    ExpectWithinCapacity(input, FS(string, Max(7)));
+    ExpectWithinCapacity(input, FS(string, Max(13)));
+    ExpectWithinCapacity(input, FS(string, Min(20), Max(9), Right));
+    ExpectWithinCapacity(input, FS(string, Graphemes, Max(4)));
+    ExpectWithinCapacity(input, FS(string, Graphemes, Max(7)));
+    ExpectWithinCapacity(input, FS(string, Columns, Max(7)));
+    ExpectWithinCapacity(input, FS(string, Columns, Graphemes, Max(5)));
+    ExpectWithinCapacity(input, FS(string, Validate, Max(6)));
+    ExpectWithinCapacity(input, FS(string, EscapeJson, Max(8)));
+    ExpectWithinCapacity(input, FS(string, Upper, Max(5)));
+    ExpectWithinCapacity(input, FS(input, Max(10), Center));
+  }
+}
+
+void TestEngineeringNotation()
+{
+  ExpectEqual(sformat_view(FD(Eng)(0.00012345)), "123.45e-6", "Eng");
+  ExpectEqual(sformat_view(FD(Eng, Frac(2))(-25.5e6)), "-25.5e+6", "Eng, Frac(2)");
+  ExpectEqual(sformat_view(FD(SI)(0.00012345)), "123.45\xC2\xB5", "SI");
+  ExpectEqual(sformat_view(FD(SI, Frac(2))(-25.5e6)), "-25.5M", "SI, Frac(2)");
+
+  // 'µ' takes up two bytes, but only one column.
+  ExpectEqual(sformat_view(FD(SI, Min(8), Right)(1.5e-6), "|"), "    1.5\xC2\xB5|", "SI, Min(8), Right");
+  ExpectEqual(sformat_view(FD(SI, Min(8), Left)(1.5e-6), "|"), "1.5\xC2\xB5    |", "SI, Min(8), Left");
+  ExpectEqual(sformat_view(FD(SI, Min(8), Center)(1.5e-6), "|"), "  1.5\xC2\xB5  |", "SI, Min(8), Center");
+
+  // Scientific notation is unaffected.
+  ExpectEqual(sformat_view(FD(Exp)(1.98765)), "1.9876e+0", "Exp");
+  ExpectEqual(sformat_view(FD(Exp, AllFrac)(4.72135e9)), "4.72135e+9", "Exp, AllFrac");
+  ExpectEqual(sformat_view(FF(Exp)(4.7601e-10f)), "4.7601e-10", "Exp (float)");
+}
+
+void TestBoundedTruncation()
+{
+  char buffer[16];
+
+  // Numbers are never cut off after some of their digits.
+  Expect(!sformat_to(buffer, 8, "x=", 123456789), "sformat_to returns false if truncated");
+  ExpectEqual(buffer, "x=", "sformat_to truncated before an integer");
+
+  Expect(!sformat_to(buffer, 11, "pi ", 3.14159, " / ", 2.5), "sformat_to returns false if truncated");
+  ExpectEqual(buffer, "pi 3.14159", "sformat_to truncated before a string");
+
+  Expect(!sformat_to(buffer, 9, "pi ", FD(Frac(5))(3.14159)), "sformat_to returns false if truncated");
+  ExpectEqual(buffer, "pi ", "sformat_to truncated before a double");
+
+  // Strings are cut off at the last complete code point.
+  Expect(!sformat_to(buffer, 11, "abc", "\xC3\xA4\xC3\xA4\xC3\xA4\xC3\xA4"), "sformat_to returns false if truncated");
+  ExpectEqual(buffer, "abc\xC3\xA4\xC3\xA4\xC3\xA4", "sformat_to truncated within a string");
+
+  sformatState &fs = sformat_GetState();
+
+  memcpy(fs.truncationMarkerChars, "\xE2\x80\xA6", 3);
+  fs.truncationMarkerLength = 3;
+
+  sformat_to(buffer, 8, "x=", 123456789);
+  ExpectEqual(buffer, "x=\xE2\x80\xA6", "sformat_to truncated before an integer with marker");
+
+  // The marker is only written if it fits completely.
+  sformat_to(buffer, 3, "abcdef", 1);
+  ExpectEqual(buffer, "ab", "sformat_to without space for the marker");
+
+  fs.truncationMarkerLength = 0;
+}
+
+void TestCaseConversion()
+{
+  ExpectEqual(sformat_view(FS("Gr\xC3\xB6\xC3\x9F" "e", Upper)), "GR\xC3\x96\xC3\x9F" "E", "Upper");
+  ExpectEqual(sformat_view(FS("\xCE\x91\xCE\x92\xCE\x93", Lower)), "\xCE\xB1\xCE\xB2\xCE\xB3", "Lower");
+
+  // Overlong sequences are invalid UTF-8 & copied unchanged instead of being decoded to ASCII.
+  ExpectEqual(sformat_view(FS("a\xC0\xA2" "b\xC1\xAF", Upper)), "A\xC0\xA2" "B\xC1\xAF", "Upper with overlong sequences");
+  ExpectEqual(sformat_view(FS("\xC0\xAF", Lower)), "\xC0\xAF", "Lower with overlong sequence");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+  sformatState_ResetCulture();
+
+  TestInvalidUtf8WithinCapacity();
+  TestEngineeringNotation();
+  TestBoundedTruncation();
+  TestCaseConversion();
+
+  sformat_fwrite(stdout, failures, " failure(s).\n");
+
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}